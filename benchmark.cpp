@@ -0,0 +1,252 @@
+
+#include "rocket.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Global allocation counting so every benchmark reports allocations per
+// operation next to its timing; regressions on either axis fail review.
+static std::atomic<long> g_allocations{ 0 };
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    struct allocation_scope final
+    {
+        explicit allocation_scope(benchmark::State& state)
+            : state{ state }
+            , start{ g_allocations.load(std::memory_order_relaxed) }
+        {
+        }
+
+        ~allocation_scope()
+        {
+            long total = g_allocations.load(std::memory_order_relaxed) - start;
+            state.counters["allocs/op"]
+                = benchmark::Counter(static_cast<double>(total) / static_cast<double>(state.iterations()));
+        }
+
+        benchmark::State& state;
+        long start;
+    };
+
+    template <class Signal>
+    void emission(benchmark::State& state)
+    {
+        Signal sig;
+        for (int i = 0; i < state.range(0); ++i)
+        {
+            sig.connect([](int x) { benchmark::DoNotOptimize(x); });
+        }
+        sig(0); // warm the emission snapshot
+
+        allocation_scope allocs{ state };
+        for (auto _ : state)
+        {
+            sig(42);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <class Signal>
+    void connect_disconnect(benchmark::State& state)
+    {
+        Signal sig;
+        allocation_scope allocs{ state };
+        for (auto _ : state)
+        {
+            rocket::connection c = sig.connect([](int) {});
+            c.disconnect();
+        }
+    }
+
+    template <class Collector>
+    void collect(benchmark::State& state)
+    {
+        rocket::signal<int(int), Collector> sig;
+        for (int i = 0; i < 8; ++i)
+        {
+            sig.connect([i](int x) { return x + i; });
+        }
+        sig(0);
+
+        allocation_scope allocs{ state };
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(sig(42));
+        }
+    }
+}
+
+static void BM_emission_thread_unsafe(benchmark::State& state)
+{
+    emission<rocket::signal<void(int)>>(state);
+}
+BENCHMARK(BM_emission_thread_unsafe)->Arg(1)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_emission_thread_safe(benchmark::State& state)
+{
+    emission<rocket::thread_safe_signal<void(int)>>(state);
+}
+BENCHMARK(BM_emission_thread_safe)->Arg(1)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_emission_thread_safe_shared(benchmark::State& state)
+{
+    emission<rocket::thread_safe_shared_signal<void(int)>>(state);
+}
+BENCHMARK(BM_emission_thread_safe_shared)->Arg(1)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_emission_batch(benchmark::State& state)
+{
+    rocket::signal<void(int)> sig;
+    for (int i = 0; i < 8; ++i)
+    {
+        sig.connect([](int x) { benchmark::DoNotOptimize(x); });
+    }
+    std::vector<std::tuple<int>> batch(static_cast<std::size_t>(state.range(0)), std::tuple<int>{ 42 });
+    sig(0);
+
+    allocation_scope allocs{ state };
+    for (auto _ : state)
+    {
+        sig.invoke_batch(batch.begin(), batch.end());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_emission_batch)->Arg(64)->Arg(1024);
+
+static void BM_connect_disconnect_thread_unsafe(benchmark::State& state)
+{
+    connect_disconnect<rocket::signal<void(int)>>(state);
+}
+BENCHMARK(BM_connect_disconnect_thread_unsafe);
+
+static void BM_connect_disconnect_thread_safe(benchmark::State& state)
+{
+    connect_disconnect<rocket::thread_safe_signal<void(int)>>(state);
+}
+BENCHMARK(BM_connect_disconnect_thread_safe);
+
+static void BM_collector_last(benchmark::State& state)
+{
+    collect<rocket::last<rocket::optional<int>>>(state);
+}
+BENCHMARK(BM_collector_last);
+
+static void BM_collector_range(benchmark::State& state)
+{
+    collect<rocket::range<int>>(state);
+}
+BENCHMARK(BM_collector_range);
+
+static void BM_collector_minimum(benchmark::State& state)
+{
+    collect<rocket::minimum<int>>(state);
+}
+BENCHMARK(BM_collector_minimum);
+
+static void BM_queued_round_trip(benchmark::State& state)
+{
+    rocket::thread_safe_signal<void(int)> sig;
+    std::atomic<long> received{ 0 };
+    sig.connect(
+        [&](int x)
+        {
+            benchmark::DoNotOptimize(x);
+            received.fetch_add(1, std::memory_order_relaxed);
+        },
+        rocket::queued_connection);
+
+    std::atomic<long> requested{ 0 };
+    std::atomic<bool> running{ true };
+    std::thread producer{ [&]
+        {
+            long produced = 0;
+            while (running.load(std::memory_order_relaxed))
+            {
+                if (produced < requested.load(std::memory_order_relaxed))
+                {
+                    sig(42);
+                    ++produced;
+                }
+            }
+        } };
+
+    long expected = 0;
+    allocation_scope allocs{ state };
+    for (auto _ : state)
+    {
+        requested.fetch_add(1, std::memory_order_relaxed);
+        ++expected;
+        while (received.load(std::memory_order_relaxed) < expected)
+        {
+            rocket::dispatch_queued_calls();
+        }
+    }
+    running = false;
+    producer.join();
+}
+BENCHMARK(BM_queued_round_trip);
+
+static void BM_timer_dispatch_due(benchmark::State& state)
+{
+    std::vector<rocket::connection> timers;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        timers.push_back(rocket::set_interval([] {}, 0ul));
+    }
+
+    {
+        allocation_scope allocs{ state };
+        for (auto _ : state)
+        {
+            rocket::dispatch_queued_calls();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    rocket::clear_timers();
+}
+BENCHMARK(BM_timer_dispatch_due)->Arg(1)->Arg(64)->Arg(1024);
+
+static void BM_timer_dispatch_idle(benchmark::State& state)
+{
+    // Nothing due: the cost of polling while many timers are pending.
+    std::vector<rocket::connection> timers;
+    for (int i = 0; i < state.range(0); ++i)
+    {
+        timers.push_back(rocket::set_timeout([] {}, 3600000ul));
+    }
+
+    for (auto _ : state)
+    {
+        rocket::dispatch_queued_calls();
+    }
+    rocket::clear_timers();
+}
+BENCHMARK(BM_timer_dispatch_idle)->Arg(1024)->Arg(16384);
+
+BENCHMARK_MAIN();
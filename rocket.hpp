@@ -25,55 +25,114 @@
  * Define this if you want to disable exceptions.                                  *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_EXCEPTIONS
-#    define ROCKET_NO_EXCEPTIONS
-#endif
+// #define ROCKET_NO_EXCEPTIONS
 
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Define this if you want to disable the `stable_list` collection in rocket.      *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_STABLE_LIST
-#    define ROCKET_NO_STABLE_LIST
-#endif
+// #define ROCKET_NO_STABLE_LIST
 
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Define this if you want to disable `set_timeout` and `set_interval` features.   *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_TIMERS
-#    define ROCKET_NO_TIMERS
-#endif
+// #define ROCKET_NO_TIMERS
 
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Define this if you want to disable the connection blocking feature.             *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-#    define ROCKET_NO_BLOCKING_CONNECTIONS
-#endif
+// #define ROCKET_NO_BLOCKING_CONNECTIONS
 
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Define this if you want to disable the queued connection feature.               *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-#    define ROCKET_NO_QUEUED_CONNECTIONS
-#endif
+// #define ROCKET_NO_QUEUED_CONNECTIONS
 
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Define this if you want to disable the smart pointer extensions feature.        *
  * ------------------------------------------------------------------------------- */
 
-#ifndef ROCKET_NO_SMARTPOINTER_EXTENSIONS
-#    define ROCKET_NO_SMARTPOINTER_EXTENSIONS
+// #define ROCKET_NO_SMARTPOINTER_EXTENSIONS
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Define this if you want to disable the per-signal target index. The index maps  *
+ * the object address passed to the object-targeted connect overloads to its       *
+ * connection nodes, so `signal::disconnect(object)` finds them in O(1) instead    *
+ * of scanning the whole connection list.                                          *
+ * ------------------------------------------------------------------------------- */
+
+// #define ROCKET_NO_TARGET_INDEX
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Define this if you want to disable the shared memory transport (shm_ring,       *
+ * shm_emitter, shm_receiver), which carries emissions with trivially copyable     *
+ * payloads between processes through a caller-mapped memory region.               *
+ * ------------------------------------------------------------------------------- */
+
+// #define ROCKET_NO_SHM_TRANSPORT
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Redefine this to change the size of the in-place storage used for slot          *
+ * callables. Callables that fit are stored inside the connection object itself;   *
+ * larger ones fall back to a heap allocation.                                     *
+ * ------------------------------------------------------------------------------- */
+
+#ifndef ROCKET_SLOT_STORAGE_SIZE
+#    define ROCKET_SLOT_STORAGE_SIZE (3 * sizeof(void*))
+#endif
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Redefine this to change the size of the in-place storage used for queued       *
+ * emission tasks. It should be big enough for a connection reference plus a      *
+ * typical decayed argument pack; oversized tasks fall back to the heap.          *
+ * ------------------------------------------------------------------------------- */
+
+#ifndef ROCKET_TASK_STORAGE_SIZE
+#    define ROCKET_TASK_STORAGE_SIZE (8 * sizeof(void*))
 #endif
 
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Define this if you want to disable the coroutine extensions even when the      *
+ * compiler supports them. They are only compiled when building as C++20 or       *
+ * later; C++17 builds are unaffected either way.                                 *
+ * ------------------------------------------------------------------------------- */
+
+// #define ROCKET_NO_COROUTINES
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Define this to compile statistics counters into the emission, call queue and   *
+ * timer dispatch paths, exposed through signal::stats() and                      *
+ * rocket::get_queue_stats(). When left undefined the counters don't exist and    *
+ * the hot paths are unchanged.                                                   *
+ * ------------------------------------------------------------------------------- */
+
+// #define ROCKET_ENABLE_STATS
+
+/***********************************************************************************
+ * ------------------------------------------------------------------------------- *
+ * Define this to compile tracing hooks into the emission and call queue paths,   *
+ * delivered to the implementation installed with rocket::set_trace_sink().       *
+ * Events carry a stable identity and a steady_clock timestamp, so external      *
+ * profilers can follow one emission or one queued task across threads. When     *
+ * left undefined the hooks don't exist and the hot paths are unchanged.         *
+ * ------------------------------------------------------------------------------- */
+
+// #define ROCKET_ENABLE_TRACING
+
 /***********************************************************************************
  * ------------------------------------------------------------------------------- *
  * Redefine this if your compiler doesn't support the `thread_local`-keyword.      *
@@ -88,24 +147,35 @@
 #include <atomic>
 #include <cassert>
 #include <cstddef>
-#include <forward_list>
 #include <functional>
 #include <initializer_list>
 #include <limits>
 #include <list>
 #include <mutex>
+#include <new>
 #include <optional>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #ifndef ROCKET_NO_QUEUED_CONNECTIONS
+#    include <condition_variable>
 #    include <deque>
 #    include <future>
 #    include <thread>
 #    include <tuple>
+#endif
+
+#if !defined(ROCKET_NO_QUEUED_CONNECTIONS) || !defined(ROCKET_NO_TARGET_INDEX)
 #    include <unordered_map>
 #endif
 
+#if !defined(ROCKET_NO_COROUTINES) && defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#    define ROCKET_HAS_COROUTINES
+#    include <coroutine>
+#endif
+
 #ifndef ROCKET_NO_EXCEPTIONS
 #    include <exception>
 #endif
@@ -118,10 +188,20 @@
 #    include <iterator>
 #endif
 
-#if !defined(ROCKET_NO_TIMERS) || !defined(ROCKET_NO_QUEUED_CONNECTIONS)
+#if !defined(ROCKET_NO_TIMERS) || !defined(ROCKET_NO_TARGET_INDEX) || !defined(ROCKET_NO_SHM_TRANSPORT)
+#    include <algorithm>
+#endif
+
+#if !defined(ROCKET_NO_TIMERS) || !defined(ROCKET_NO_QUEUED_CONNECTIONS) || defined(ROCKET_ENABLE_STATS) \
+    || defined(ROCKET_ENABLE_TRACING) || !defined(ROCKET_NO_SHM_TRANSPORT)
 #    include <chrono>
 #endif
 
+#ifndef ROCKET_NO_SHM_TRANSPORT
+#    include <cstdint>
+#    include <cstring>
+#endif
+
 #if __has_cpp_attribute(likely)
 #    define ROCKET_LIKELY [[likely]]
 #else
@@ -226,6 +306,13 @@ namespace rocket
             }
         }
 
+        // The first value satisfies this collector; the emission engine stops
+        // calling the remaining slots once it is in.
+        ROCKET_NODISCARD bool done() const noexcept
+        {
+            return has_value;
+        }
+
         ROCKET_NODISCARD result_type result()
         {
             return std::move(current);
@@ -236,6 +323,38 @@ namespace rocket
         bool has_value{ false };
     };
 
+    // Short-circuiting "handled" collector: keeps the last value seen and
+    // ends the emission as soon as a slot returns a value that tests true.
+    // The classic use is event routing over signal<bool(Event)>, where the
+    // first handler that consumes the event wins and the rest never run.
+    template <class T>
+    struct until
+    {
+        using value_type = T;
+        using result_type = T;
+
+        template <class U>
+        void operator()(U&& value)
+        {
+            current = std::forward<U>(value);
+            satisfied = static_cast<bool>(current);
+        }
+
+        ROCKET_NODISCARD bool done() const noexcept
+        {
+            return satisfied;
+        }
+
+        ROCKET_NODISCARD result_type result()
+        {
+            return std::move(current);
+        }
+
+    private:
+        value_type current{};
+        bool satisfied{ false };
+    };
+
     template <class T>
     struct last
     {
@@ -278,6 +397,35 @@ namespace rocket
         std::list<value_type> values;
     };
 
+    // Contiguous alternative to range: results land in one vector instead of
+    // a list node per value. The emission engine calls reserve() with the
+    // slot count before the first value arrives.
+    template <class T>
+    struct vector_range
+    {
+        using value_type = T;
+        using result_type = std::vector<T>;
+
+        void reserve(std::size_t capacity)
+        {
+            values.reserve(capacity);
+        }
+
+        template <class U>
+        void operator()(U&& value)
+        {
+            values.emplace_back(std::forward<U>(value));
+        }
+
+        ROCKET_NODISCARD result_type result()
+        {
+            return std::move(values);
+        }
+
+    private:
+        std::vector<value_type> values;
+    };
+
 #ifndef ROCKET_NO_EXCEPTIONS
     struct error : std::exception
     {
@@ -726,11 +874,218 @@ namespace rocket
         RefCount count{};
     };
 
+    // Customization point for the small node objects rocket allocates on
+    // connect and on stable_list insert. Install an implementation with
+    // set_node_allocator to carve nodes from an arena or pool instead of the
+    // global heap; an arena may treat deallocate as a no-op and reclaim in
+    // one batch once all signals using it are gone. The implementation must
+    // be thread-safe if nodes are created or released from multiple threads,
+    // and must stay installed for as long as nodes allocated through it are
+    // still alive.
+    struct node_allocator
+    {
+        virtual void* allocate(std::size_t size) = 0;
+        virtual void deallocate(void* ptr, std::size_t size) noexcept = 0;
+
+    protected:
+        virtual ~node_allocator() = default;
+    };
+
+    namespace detail
+    {
+        inline std::atomic<node_allocator*>& node_allocator_instance() noexcept
+        {
+            static std::atomic<node_allocator*> instance{ nullptr };
+            return instance;
+        }
+
+        // Node types derive from this so their allocation functions route
+        // through the installed node allocator; with none installed the
+        // global heap is used, as before.
+        struct node_allocation
+        {
+            static void* operator new(std::size_t size)
+            {
+                if (node_allocator* allocator = node_allocator_instance().load(std::memory_order_acquire))
+                    ROCKET_UNLIKELY
+                    {
+                        return allocator->allocate(size);
+                    }
+                return ::operator new(size);
+            }
+
+            static void operator delete(void* ptr, std::size_t size) noexcept
+            {
+                if (node_allocator* allocator = node_allocator_instance().load(std::memory_order_acquire))
+                    ROCKET_UNLIKELY
+                    {
+                        allocator->deallocate(ptr, size);
+                        return;
+                    }
+                ::operator delete(ptr);
+            }
+        };
+    } // namespace detail
+
+    inline node_allocator* set_node_allocator(node_allocator* allocator) noexcept
+    {
+        return detail::node_allocator_instance().exchange(allocator, std::memory_order_acq_rel);
+    }
+
+    ROCKET_NODISCARD inline node_allocator* get_node_allocator() noexcept
+    {
+        return detail::node_allocator_instance().load(std::memory_order_acquire);
+    }
+
+#ifdef ROCKET_ENABLE_TRACING
+    // Customization point for emission and call queue tracing, compiled in by
+    // ROCKET_ENABLE_TRACING. Install an implementation with set_trace_sink to
+    // receive the events; typical implementations forward them to Perfetto or
+    // USDT tracepoints. signal_id is the emitting signal's address - stable
+    // for its lifetime - and task_id identifies one queued task from enqueue
+    // to execution, so cross-thread queued latency can be pieced together
+    // from the timestamps. Callbacks fire on the emitting and dispatching
+    // threads and must be thread-safe; they must also stay cheap, since they
+    // sit right on the hot paths they observe.
+    struct trace_sink
+    {
+        using time_point = std::chrono::steady_clock::time_point;
+
+        virtual void emit_begin(void const* signal_id, time_point when) noexcept = 0;
+        virtual void emit_end(void const* signal_id, time_point when) noexcept = 0;
+        virtual void task_enqueued(void const* task_id, time_point when) noexcept = 0;
+        virtual void task_started(void const* task_id, time_point when) noexcept = 0;
+        virtual void task_finished(void const* task_id, time_point when) noexcept = 0;
+
+    protected:
+        virtual ~trace_sink() = default;
+    };
+
+    namespace detail
+    {
+        inline std::atomic<trace_sink*>& trace_sink_instance() noexcept
+        {
+            static std::atomic<trace_sink*> instance{ nullptr };
+            return instance;
+        }
+    } // namespace detail
+
+    inline trace_sink* set_trace_sink(trace_sink* sink) noexcept
+    {
+        return detail::trace_sink_instance().exchange(sink, std::memory_order_acq_rel);
+    }
+
+    ROCKET_NODISCARD inline trace_sink* get_trace_sink() noexcept
+    {
+        return detail::trace_sink_instance().load(std::memory_order_acquire);
+    }
+
+    namespace detail
+    {
+        // Brackets one emission with emit_begin/emit_end; the end event fires
+        // on every exit path, including slot exceptions. The sink observed at
+        // begin is kept so both events always land in the same sink.
+        struct trace_emission_scope final
+        {
+            explicit trace_emission_scope(void const* signal_id) noexcept
+                : sink{ get_trace_sink() }
+                , id{ signal_id }
+            {
+                if (sink != nullptr)
+                {
+                    sink->emit_begin(id, std::chrono::steady_clock::now());
+                }
+            }
+
+            ~trace_emission_scope() noexcept
+            {
+                if (sink != nullptr)
+                {
+                    sink->emit_end(id, std::chrono::steady_clock::now());
+                }
+            }
+
+            trace_sink* sink;
+            void const* id;
+        };
+    } // namespace detail
+#endif//~ ROCKET_ENABLE_TRACING
+
+#ifdef ROCKET_ENABLE_STATS
+    // Snapshot of the counters a signal accumulates while stats are compiled
+    // in; taken with relaxed atomics, so values are individually accurate but
+    // not mutually consistent.
+    struct signal_stats final
+    {
+        unsigned long long emission_count;
+        unsigned long long slot_call_count;
+        unsigned long long slot_time_total_ns;
+        unsigned long long slot_time_max_ns;
+        unsigned long long abort_count;
+    };
+
+    struct queue_stats final
+    {
+        unsigned long long queued_task_count;
+        unsigned long long executed_task_count;
+        unsigned long long queued_depth_high_water;
+        unsigned long long timer_fired_count;
+    };
+
+    namespace detail
+    {
+        inline void update_maximum(std::atomic<unsigned long long>& target, unsigned long long value) noexcept
+        {
+            unsigned long long current = target.load(std::memory_order_relaxed);
+            while (current < value
+                && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        struct signal_stats_data final
+        {
+            std::atomic<unsigned long long> emission_count{ 0 };
+            std::atomic<unsigned long long> slot_call_count{ 0 };
+            std::atomic<unsigned long long> slot_time_total_ns{ 0 };
+            std::atomic<unsigned long long> slot_time_max_ns{ 0 };
+            std::atomic<unsigned long long> abort_count{ 0 };
+        };
+
+        struct queue_stats_data final
+        {
+            std::atomic<unsigned long long> queued_task_count{ 0 };
+            std::atomic<unsigned long long> executed_task_count{ 0 };
+            std::atomic<unsigned long long> queued_depth_high_water{ 0 };
+            std::atomic<unsigned long long> timer_fired_count{ 0 };
+        };
+
+        inline queue_stats_data& get_queue_stats_data() noexcept
+        {
+            static queue_stats_data data;
+            return data;
+        }
+    } // namespace detail
+
+    ROCKET_NODISCARD inline queue_stats get_queue_stats() noexcept
+    {
+        detail::queue_stats_data& data = detail::get_queue_stats_data();
+        return queue_stats{
+            data.queued_task_count.load(std::memory_order_relaxed),
+            data.executed_task_count.load(std::memory_order_relaxed),
+            data.queued_depth_high_water.load(std::memory_order_relaxed),
+            data.timer_fired_count.load(std::memory_order_relaxed),
+        };
+    }
+#endif//~ ROCKET_ENABLE_STATS
+
 #ifndef ROCKET_NO_STABLE_LIST
     template <class T>
     class stable_list final
     {
-        struct link_element final : ref_counted<link_element>
+        struct block_arena;
+
+        struct link_element final
         {
             link_element() noexcept = default;
 
@@ -742,6 +1097,24 @@ namespace rocket
                 }
             }
 
+            void addref() noexcept
+            {
+                count.addref();
+            }
+
+            void release() noexcept
+            {
+                if (count.release() == 0)
+                {
+                    // Keep the arena alive past our own teardown, then hand
+                    // the slot back for reuse; the arena itself dies once the
+                    // list and every outstanding node are gone.
+                    intrusive_ptr<block_arena> owner{ std::move(arena) };
+                    this->~link_element();
+                    owner->recycle(this);
+                }
+            }
+
             template <class... Args>
             void construct(Args&&... args) noexcept(noexcept(T{ std::forward<Args>(args)... }))
             {
@@ -761,12 +1134,82 @@ namespace rocket
             intrusive_ptr<link_element> next;
             intrusive_ptr<link_element> prev;
 
+            intrusive_ptr<block_arena> arena;
+
+            ref_count count{};
+
             alignas(T) std::byte buffer[sizeof(T)];
         };
 
+        // Backing storage for the links: fixed-size blocks carved into node
+        // slots in address order, with erased slots recycled through a free
+        // list threaded over the dead storage. Consecutively inserted nodes
+        // land next to each other, so the iteration path mostly walks
+        // contiguous memory instead of chasing individual heap allocations.
+        // Ref-counted because erased links can outlive the list through
+        // iterators that still hold them.
+        struct block_arena final : ref_counted<block_arena>, detail::node_allocation
+        {
+            // One block holds as many nodes as fit a 4 KiB page, at least four.
+            static constexpr std::size_t nodes_per_block
+                = sizeof(link_element) * 4 > 4096 ? 4 : 4096 / sizeof(link_element);
+
+            struct free_slot
+            {
+                free_slot* next;
+            };
+
+            struct block final : detail::node_allocation
+            {
+                block* next{ nullptr };
+                alignas(link_element) std::byte storage[nodes_per_block * sizeof(link_element)];
+            };
+
+            ~block_arena() noexcept
+            {
+                while (blocks != nullptr)
+                {
+                    block* next = blocks->next;
+                    delete blocks;
+                    blocks = next;
+                }
+            }
+
+            ROCKET_NODISCARD void* allocate()
+            {
+                if (free_list != nullptr)
+                {
+                    free_slot* slot = free_list;
+                    free_list = slot->next;
+                    return static_cast<void*>(slot);
+                }
+                if (used == nodes_per_block)
+                {
+                    block* b = new block;
+                    b->next = blocks;
+                    blocks = b;
+                    used = 0;
+                }
+                return static_cast<void*>(blocks->storage + used++ * sizeof(link_element));
+            }
+
+            void recycle(void* slot) noexcept
+            {
+                free_slot* head = static_cast<free_slot*>(slot);
+                head->next = free_list;
+                free_list = head;
+            }
+
+            block* blocks{ nullptr };
+            free_slot* free_list{ nullptr };
+            std::size_t used{ nodes_per_block };
+        };
+
         intrusive_ptr<link_element> head;
         intrusive_ptr<link_element> tail;
 
+        intrusive_ptr<block_arena> arena;
+
         std::size_t elements;
 
     public:
@@ -922,6 +1365,7 @@ namespace rocket
         stable_list(stable_list&& l)
             : head{ std::move(l.head) }
             , tail{ std::move(l.tail) }
+            , arena{ std::move(l.arena) }
             , elements{ l.elements }
         {
             l.init();
@@ -967,6 +1411,7 @@ namespace rocket
             destroy();
             head = std::move(l.head);
             tail = std::move(l.tail);
+            arena = std::move(l.arena);
             elements = l.elements;
             l.init();
             return *this;
@@ -1291,6 +1736,7 @@ namespace rocket
             {
                 head.swap(other.head);
                 tail.swap(other.tail);
+                arena.swap(other.arena);
                 std::swap(elements, other.elements);
             }
         }
@@ -1298,8 +1744,9 @@ namespace rocket
     private:
         void init()
         {
-            head = new link_element;
-            tail = new link_element;
+            arena = intrusive_ptr<block_arena>{ new block_arena };
+            head = new_link();
+            tail = new_link();
             head->next = tail;
             tail->prev = head;
             elements = 0;
@@ -1312,10 +1759,17 @@ namespace rocket
             tail->prev = nullptr;
         }
 
+        ROCKET_NODISCARD intrusive_ptr<link_element> new_link()
+        {
+            intrusive_ptr<link_element> link{ new (arena->allocate()) link_element };
+            link->arena = arena;
+            return link;
+        }
+
         template <class... Args>
         link_element* make_link(link_element* l, Args&&... args)
         {
-            intrusive_ptr<link_element> link{ new link_element };
+            intrusive_ptr<link_element> link{ new_link() };
             link->construct(std::forward<Args>(args)...);
             link->prev = l->prev;
             link->next = l;
@@ -1327,13 +1781,25 @@ namespace rocket
     };
 #endif//~ ROCKET_NO_STABLE_LIST
 
-    template <bool ThreadSafe>
+    template <bool ThreadSafe, bool SharedLock = false, bool LockFreeEmission = false>
     struct threading_policy
     {
         static constexpr bool is_thread_safe = ThreadSafe;
+        static constexpr bool is_shared_lock = ThreadSafe && SharedLock && !LockFreeEmission;
+        static constexpr bool is_lock_free_emission = ThreadSafe && LockFreeEmission;
     };
 
     using thread_safe_policy = threading_policy<true>;
+    // Like thread_safe_policy, but emissions only take the shared side of the
+    // signal lock, so read-mostly signals can be emitted from many threads
+    // concurrently; connect and disconnect still take the exclusive side.
+    using thread_safe_shared_policy = threading_policy<true, true>;
+    // Emission reads one atomic snapshot pointer and takes no lock at all;
+    // connect and clear rebuild the snapshot under the exclusive lock and
+    // publish it atomically, with grace-period reclamation of old snapshots.
+    // The right choice when emissions outnumber mutations by orders of
+    // magnitude.
+    using thread_safe_rcu_policy = threading_policy<true, false, true>;
     using thread_unsafe_policy = threading_policy<false>;
 
     namespace detail
@@ -1351,1645 +1817,4732 @@ namespace rocket
         template <class Signature>
         using get_return_type = typename expand_signature<Signature>::return_type;
 
-        struct shared_lock final : ref_counted<shared_lock, ref_count_atomic>
+        template <class Collector, class = void>
+        struct collector_has_reserve : std::false_type
         {
-            std::mutex mutex;
         };
 
-        template <class ThreadingPolicy>
-        struct shared_lock_state;
+        template <class Collector>
+        struct collector_has_reserve<
+            Collector,
+            std::void_t<decltype(std::declval<Collector&>().reserve(std::size_t{}))>> : std::true_type
+        {
+        };
 
-        template <>
-        struct shared_lock_state<thread_unsafe_policy> final
+        // Collectors may expose `bool done() const` to short-circuit the
+        // emission: once it returns true the engine stops calling the
+        // remaining slots, like an emission abort with a collected result.
+        template <class Collector, class = void>
+        struct collector_has_done : std::false_type
         {
-            using threading_policy = thread_unsafe_policy;
+        };
 
-            constexpr void lock() noexcept
-            {
-            }
+        template <class Collector>
+        struct collector_has_done<
+            Collector,
+            std::void_t<decltype(static_cast<bool>(std::declval<Collector const&>().done()))>>
+            : std::true_type
+        {
+        };
 
-            constexpr bool try_lock() noexcept
+        // Writes each collected value through a caller-supplied output
+        // iterator; used by signal::invoke_into to fill preallocated buffers
+        // without the engine allocating anything itself.
+        template <class T, class OutputIterator>
+        struct output_collector final
+        {
+            using value_type = T;
+            using result_type = OutputIterator;
+
+            explicit output_collector(OutputIterator out)
+                : out{ std::move(out) }
             {
-                return true;
             }
 
-            constexpr void unlock() noexcept
+            template <class U>
+            void operator()(U&& value)
             {
+                *out++ = std::forward<U>(value);
             }
 
-            constexpr void swap(shared_lock_state&) noexcept
+            ROCKET_NODISCARD result_type result()
             {
+                return std::move(out);
             }
+
+        private:
+            OutputIterator out;
         };
 
-        template <>
-        struct shared_lock_state<thread_safe_policy> final
+        // A light-weight replacement for std::function that keeps small callables
+        // in an in-place buffer inside the owning object. The typical slot - a
+        // lambda capturing an object pointer plus a member function pointer - fits
+        // into ROCKET_SLOT_STORAGE_SIZE bytes and is stored and invoked without
+        // touching the heap.
+        template <class Signature>
+        class slot_function;
+
+        template <class R, class... Args>
+        class slot_function<R(Args...)> final
         {
-            using threading_policy = thread_safe_policy;
+            union storage_type
+            {
+                void* pointer;
+                alignas(alignof(void*)) std::byte buffer[ROCKET_SLOT_STORAGE_SIZE];
+            };
 
-            shared_lock_state()
-                : lock_primitive{ new shared_lock }
+            // The invoke trampoline lives directly in the slot_function, so
+            // calling a slot is one pointer load and one indirect call; the
+            // table only carries the cold lifecycle operations.
+            struct callable_ops final
             {
-            }
+                void (*clone)(storage_type const&, storage_type&);
+                void (*relocate)(storage_type&, storage_type&) noexcept;
+                void (*destroy)(storage_type&) noexcept;
+            };
 
-            ~shared_lock_state() = default;
+            template <class Callable>
+            static constexpr bool is_inline_storable = sizeof(Callable) <= sizeof(storage_type)
+                && alignof(Callable) <= alignof(storage_type)
+                && std::is_nothrow_move_constructible_v<Callable>;
 
-            shared_lock_state(shared_lock_state const& s)
-                : lock_primitive{ s.lock_primitive }
+            template <class Callable, bool IsInline = is_inline_storable<Callable>>
+            struct ops_for;
+
+            template <class Callable>
+            struct ops_for<Callable, true> final
             {
-            }
+                static Callable* get(storage_type const& s) noexcept
+                {
+                    return std::launder(reinterpret_cast<Callable*>(const_cast<std::byte*>(s.buffer)));
+                }
 
-            shared_lock_state(shared_lock_state&& s)
-                : lock_primitive{ std::move(s.lock_primitive) }
+                template <class C>
+                static void construct(storage_type& s, C&& c)
+                {
+                    new (static_cast<void*>(s.buffer)) Callable{ std::forward<C>(c) };
+                }
+
+                static R invoke(storage_type const& s, Args&&... args)
+                {
+                    return R((*get(s))(std::forward<Args>(args)...));
+                }
+
+                static void clone(storage_type const& s, storage_type& d)
+                {
+                    new (static_cast<void*>(d.buffer)) Callable{ *get(s) };
+                }
+
+                static void relocate(storage_type& s, storage_type& d) noexcept
+                {
+                    new (static_cast<void*>(d.buffer)) Callable{ std::move(*get(s)) };
+                    get(s)->~Callable();
+                }
+
+                static void destroy(storage_type& s) noexcept
+                {
+                    get(s)->~Callable();
+                }
+            };
+
+            template <class Callable>
+            struct ops_for<Callable, false> final
             {
-                s.lock_primitive = new shared_lock;
-            }
+                static Callable* get(storage_type const& s) noexcept
+                {
+                    return static_cast<Callable*>(s.pointer);
+                }
 
-            shared_lock_state& operator=(shared_lock_state const& rhs)
+                template <class C>
+                static void construct(storage_type& s, C&& c)
+                {
+                    s.pointer = new Callable{ std::forward<C>(c) };
+                }
+
+                static R invoke(storage_type const& s, Args&&... args)
+                {
+                    return R((*get(s))(std::forward<Args>(args)...));
+                }
+
+                static void clone(storage_type const& s, storage_type& d)
+                {
+                    d.pointer = new Callable{ *get(s) };
+                }
+
+                static void relocate(storage_type& s, storage_type& d) noexcept
+                {
+                    d.pointer = s.pointer;
+                }
+
+                static void destroy(storage_type& s) noexcept
+                {
+                    delete get(s);
+                }
+            };
+
+            template <class Callable>
+            static callable_ops const* ops_table() noexcept
             {
-                lock_primitive = rhs.lock_primitive;
-                return *this;
+                static constexpr callable_ops table{
+                    &ops_for<Callable>::clone,
+                    &ops_for<Callable>::relocate,
+                    &ops_for<Callable>::destroy,
+                };
+                return &table;
             }
 
-            shared_lock_state& operator=(shared_lock_state&& rhs)
+        public:
+            slot_function() noexcept = default;
+
+            slot_function(std::nullptr_t) noexcept
             {
-                lock_primitive = std::move(rhs.lock_primitive);
-                rhs.lock_primitive = new shared_lock;
-                return *this;
             }
 
-            void lock()
+            template <
+                class Callable,
+                std::enable_if_t<
+                    !std::is_same_v<std::decay_t<Callable>, slot_function>
+                        && std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>,
+                    int> = 0>
+            slot_function(Callable&& c)
+                : ops{ ops_table<std::decay_t<Callable>>() }
+                , invoke_fn{ &ops_for<std::decay_t<Callable>>::invoke }
             {
-                lock_primitive->mutex.lock();
+                ops_for<std::decay_t<Callable>>::construct(storage, std::forward<Callable>(c));
             }
 
-            bool try_lock()
+            slot_function(slot_function const& s)
+                : ops{ s.ops }
+                , invoke_fn{ s.invoke_fn }
             {
-                return lock_primitive->mutex.try_lock();
+                if (ops)
+                {
+                    ops->clone(s.storage, storage);
+                }
             }
 
-            void unlock()
+            slot_function(slot_function&& s) noexcept
+                : ops{ s.ops }
+                , invoke_fn{ s.invoke_fn }
             {
-                lock_primitive->mutex.unlock();
+                if (ops)
+                {
+                    ops->relocate(s.storage, storage);
+                    s.ops = nullptr;
+                    s.invoke_fn = nullptr;
+                }
             }
 
-            void swap(shared_lock_state& s) noexcept
+            ~slot_function() noexcept
             {
-                lock_primitive.swap(s.lock_primitive);
+                if (ops)
+                {
+                    ops->destroy(storage);
+                }
             }
 
-            intrusive_ptr<shared_lock> lock_primitive;
-        };
-
-        template <class ThreadingPolicy>
-        struct connection_base;
-
-        template <>
-        struct connection_base<thread_unsafe_policy> : ref_counted<connection_base<thread_unsafe_policy>>
-        {
-            using threading_policy = thread_unsafe_policy;
-
-            virtual ~connection_base() noexcept = default;
-
-            ROCKET_NODISCARD bool is_connected() const noexcept
+            slot_function& operator=(slot_function const& rhs)
             {
-                return prev != nullptr;
+                if (this != &rhs)
+                {
+                    slot_function tmp{ rhs };
+                    *this = std::move(tmp);
+                }
+                return *this;
             }
 
-            void disconnect() noexcept
+            slot_function& operator=(slot_function&& rhs) noexcept
             {
-                if (prev != nullptr)
+                if (this != &rhs)
                 {
-                    next->prev = prev;
-                    prev->next = next;
+                    if (ops)
+                    {
+                        ops->destroy(storage);
+                    }
+                    ops = rhs.ops;
+                    invoke_fn = rhs.invoke_fn;
+                    if (ops)
+                    {
+                        ops->relocate(rhs.storage, storage);
+                        rhs.ops = nullptr;
+                        rhs.invoke_fn = nullptr;
+                    }
+                }
+                return *this;
+            }
 
-                    // To mark a connection as disconnected, just set its prev-link to null but
-                    // leave the next link alive so we can still traverse through the connections
-                    // if the slot gets disconnected during signal emit.
-                    prev = nullptr;
+            slot_function& operator=(std::nullptr_t) noexcept
+            {
+                if (ops)
+                {
+                    ops->destroy(storage);
+                    ops = nullptr;
+                    invoke_fn = nullptr;
                 }
+                return *this;
             }
 
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-            ROCKET_NODISCARD std::thread::id get_tid() const noexcept
+            R operator()(Args... args) const
             {
-                return std::thread::id{};
+                assert(invoke_fn != nullptr);
+                return invoke_fn(storage, std::forward<Args>(args)...);
             }
 
-            ROCKET_NODISCARD constexpr bool is_queued() const noexcept
+            ROCKET_NODISCARD explicit operator bool() const noexcept
             {
-                return false;
+                return ops != nullptr;
             }
-#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
 
-#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-            void block() noexcept
+            ROCKET_NODISCARD friend bool operator==(slot_function const& f, std::nullptr_t) noexcept
             {
-                ++block_count;
+                return !f;
             }
 
-            void unblock() noexcept
+            ROCKET_NODISCARD friend bool operator==(std::nullptr_t, slot_function const& f) noexcept
             {
-                if (block_count > 0)
-                {
-                    --block_count;
-                }
+                return !f;
             }
 
-            ROCKET_NODISCARD bool is_blocked() const noexcept
+            ROCKET_NODISCARD friend bool operator!=(slot_function const& f, std::nullptr_t) noexcept
             {
-                return block_count > 0;
+                return static_cast<bool>(f);
             }
 
-            unsigned long block_count{ 0 };
-#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+            ROCKET_NODISCARD friend bool operator!=(std::nullptr_t, slot_function const& f) noexcept
+            {
+                return static_cast<bool>(f);
+            }
 
-            intrusive_ptr<connection_base> next;
-            intrusive_ptr<connection_base> prev;
+        private:
+            callable_ops const* ops{ nullptr };
+            R (*invoke_fn)(storage_type const&, Args&&...){ nullptr };
+            storage_type storage;
         };
 
-        template <>
-        struct connection_base<thread_safe_policy> : ref_counted<connection_base<thread_safe_policy>, ref_count_atomic>
+        // Connection payload for the compile-time member function overloads:
+        // only the instance pointer is stored and the member pointer is baked
+        // into the type, so the slot trampoline specializes per method and
+        // collapses to a direct, inlinable call.
+        template <auto Method, class Instance>
+        struct bound_method final
         {
-            using threading_policy = thread_safe_policy;
-
-            virtual ~connection_base() noexcept = default;
+            Instance* object;
 
-            ROCKET_NODISCARD bool is_connected() const noexcept
+            template <class... CallArgs>
+            decltype(auto) operator()(CallArgs&&... args) const
             {
-                return prev != nullptr;
+                return (object->*Method)(std::forward<CallArgs>(args)...);
             }
+        };
 
-            void disconnect() noexcept
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        // Move-only counterpart to slot_function used for queued emissions.
+        // A fire-and-forget task captures a connection reference plus the
+        // decayed argument pack; ROCKET_TASK_STORAGE_SIZE is chosen so typical
+        // packs live inside the queue node with no further allocation. The
+        // blocking, value-returning path still goes through std::packaged_task,
+        // which simply gets stored in here as well.
+        class task_function final
+        {
+            union storage_type
             {
-                std::scoped_lock<std::mutex> guard{ lock->mutex };
+                void* pointer;
+                alignas(alignof(std::max_align_t)) std::byte buffer[ROCKET_TASK_STORAGE_SIZE];
+            };
 
-                if (prev != nullptr)
+            struct task_ops final
+            {
+                void (*invoke)(storage_type const&);
+                void (*relocate)(storage_type&, storage_type&) noexcept;
+                void (*destroy)(storage_type&) noexcept;
+            };
+
+            template <class Callable>
+            static constexpr bool is_inline_storable = sizeof(Callable) <= sizeof(storage_type)
+                && alignof(Callable) <= alignof(storage_type)
+                && std::is_nothrow_move_constructible_v<Callable>;
+
+            template <class Callable, bool IsInline = is_inline_storable<Callable>>
+            struct ops_for;
+
+            template <class Callable>
+            struct ops_for<Callable, true> final
+            {
+                static Callable* get(storage_type const& s) noexcept
                 {
-                    next->prev = prev;
-                    prev->next = next;
+                    return std::launder(reinterpret_cast<Callable*>(const_cast<std::byte*>(s.buffer)));
+                }
 
-                    // To mark a connection as disconnected, just set its prev-link to null but
-                    // leave the next link alive so we can still traverse through the connections
-                    // if the slot gets disconnected during signal emit.
-                    prev = nullptr;
+                template <class C>
+                static void construct(storage_type& s, C&& c)
+                {
+                    new (static_cast<void*>(s.buffer)) Callable{ std::forward<C>(c) };
                 }
-            }
 
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-            ROCKET_NODISCARD std::thread::id const& get_tid() const noexcept
+                static void invoke(storage_type const& s)
+                {
+                    (*get(s))();
+                }
+
+                static void relocate(storage_type& s, storage_type& d) noexcept
+                {
+                    new (static_cast<void*>(d.buffer)) Callable{ std::move(*get(s)) };
+                    get(s)->~Callable();
+                }
+
+                static void destroy(storage_type& s) noexcept
+                {
+                    get(s)->~Callable();
+                }
+            };
+
+            template <class Callable>
+            struct ops_for<Callable, false> final
             {
-                return thread_id;
+                static Callable* get(storage_type const& s) noexcept
+                {
+                    return static_cast<Callable*>(s.pointer);
+                }
+
+                template <class C>
+                static void construct(storage_type& s, C&& c)
+                {
+                    s.pointer = new Callable{ std::forward<C>(c) };
+                }
+
+                static void invoke(storage_type const& s)
+                {
+                    (*get(s))();
+                }
+
+                static void relocate(storage_type& s, storage_type& d) noexcept
+                {
+                    d.pointer = s.pointer;
+                }
+
+                static void destroy(storage_type& s) noexcept
+                {
+                    delete get(s);
+                }
+            };
+
+            template <class Callable>
+            static task_ops const* ops_table() noexcept
+            {
+                static constexpr task_ops table{
+                    &ops_for<Callable>::invoke,
+                    &ops_for<Callable>::relocate,
+                    &ops_for<Callable>::destroy,
+                };
+                return &table;
             }
 
-            ROCKET_NODISCARD bool is_queued() const noexcept
+        public:
+            task_function() noexcept = default;
+
+            template <
+                class Callable,
+                std::enable_if_t<
+                    !std::is_same_v<std::decay_t<Callable>, task_function>
+                        && std::is_invocable_v<std::decay_t<Callable>&>,
+                    int> = 0>
+            task_function(Callable&& c)
+                : ops{ ops_table<std::decay_t<Callable>>() }
             {
-                return thread_id != std::thread::id{} && thread_id != std::this_thread::get_id();
+                ops_for<std::decay_t<Callable>>::construct(storage, std::forward<Callable>(c));
             }
-#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
 
-#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-            void block() noexcept
+            task_function(task_function&& t) noexcept
+                : ops{ t.ops }
             {
-                std::scoped_lock<std::mutex> guard{ lock->mutex };
-                ++block_count;
+                if (ops)
+                {
+                    ops->relocate(t.storage, storage);
+                    t.ops = nullptr;
+                }
             }
 
-            void unblock() noexcept
+            ~task_function() noexcept
             {
-                std::scoped_lock<std::mutex> guard{ lock->mutex };
-                if (block_count > 0)
+                if (ops)
                 {
-                    --block_count;
+                    ops->destroy(storage);
                 }
             }
 
-            ROCKET_NODISCARD bool is_blocked() const noexcept
+            task_function& operator=(task_function&& rhs) noexcept
             {
-                return (*static_cast<unsigned long const volatile*>(&block_count)) > 0;
+                if (this != &rhs)
+                {
+                    if (ops)
+                    {
+                        ops->destroy(storage);
+                    }
+                    ops = rhs.ops;
+                    if (ops)
+                    {
+                        ops->relocate(rhs.storage, storage);
+                        rhs.ops = nullptr;
+                    }
+                }
+                return *this;
             }
 
-            unsigned long block_count{ 0 };
-#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+            void operator()() const
+            {
+                assert(ops != nullptr);
+                ops->invoke(storage);
+            }
 
-            intrusive_ptr<connection_base> next;
-            intrusive_ptr<connection_base> prev;
+            ROCKET_NODISCARD explicit operator bool() const noexcept
+            {
+                return ops != nullptr;
+            }
 
-            intrusive_ptr<shared_lock> lock;
+        private:
+            task_function(task_function const&) = delete;
+            task_function& operator=(task_function const&) = delete;
 
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-            std::thread::id thread_id;
-#endif
+            task_ops const* ops{ nullptr };
+            storage_type storage;
         };
 
-        template <class ThreadingPolicy, class T>
-        struct functional_connection : connection_base<ThreadingPolicy>
+        // Anything with a post(task_function) member qualifies as an executor
+        // sink for queued connections.
+        template <class Executor, class = void>
+        struct is_executor : std::false_type
         {
-            std::function<T> slot;
         };
 
-#ifndef ROCKET_NO_TIMERS
-        struct timed_connection final : functional_connection<thread_unsafe_policy, void()>
+        template <class Executor>
+        struct is_executor<
+            Executor,
+            std::void_t<decltype(std::declval<Executor&>().post(std::declval<task_function>()))>>
+            : std::true_type
         {
-            std::chrono::time_point<std::chrono::steady_clock> expires_at;
-            std::chrono::microseconds interval;
         };
-#endif
-        // Should make sure that this is POD
-        struct thread_local_data final
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+
+        // Both thread safe policies share this primitive (and through it one
+        // connection_base type); the exclusive side is always used for
+        // structural mutation, while thread_safe_shared_policy emissions only
+        // take the shared side.
+        struct shared_lock : ref_counted<shared_lock, ref_count_atomic>
         {
-            void* current_connection;
-            bool is_thread_safe_connection;
-            bool emission_aborted;
+            virtual ~shared_lock() noexcept = default;
+
+            std::shared_mutex mutex;
         };
 
-        ROCKET_NODISCARD inline thread_local_data* get_thread_local_data() noexcept
-        {
-            static ROCKET_THREAD_LOCAL thread_local_data th;
-            return &th;
-        }
+        // Allocates the signal_control_block a thread safe signal shares
+        // with its connection nodes; defined once the node types it embeds
+        // are complete.
+        ROCKET_NODISCARD inline shared_lock* make_control_block();
 
-        struct connection_scope final
+        // Bumps the control block's mutation generation; callers hold the
+        // exclusive lock.
+        inline void bump_generation(shared_lock* lock) noexcept;
+
+        // Maps a threading policy to the policy its connection nodes are
+        // instantiated with, so the type-erased rocket::connection front end
+        // keeps seeing exactly two node types.
+        template <class ThreadingPolicy>
+        using node_policy
+            = std::conditional_t<ThreadingPolicy::is_thread_safe, thread_safe_policy, thread_unsafe_policy>;
+
+        template <class ThreadingPolicy>
+        struct shared_lock_state;
+
+        template <>
+        struct shared_lock_state<thread_unsafe_policy> final
         {
-            connection_scope(void* base, bool is_thread_safe, thread_local_data* th) noexcept
-                : th{ th }
-                , prev{ th->current_connection }
-                , prevThreadSafe{ th->is_thread_safe_connection }
+            using threading_policy = thread_unsafe_policy;
+
+            constexpr void lock() noexcept
             {
-                th->current_connection = base;
-                th->is_thread_safe_connection = is_thread_safe;
             }
 
-            ~connection_scope() noexcept
+            constexpr bool try_lock() noexcept
             {
-                th->current_connection = prev;
-                th->is_thread_safe_connection = prevThreadSafe;
+                return true;
             }
 
-            thread_local_data* th;
-            void* prev;
-            bool prevThreadSafe;
-        };
+            constexpr void unlock() noexcept
+            {
+            }
 
-        struct abort_scope final
-        {
-            abort_scope(thread_local_data* th) noexcept
-                : th{ th }
-                , prev{ th->emission_aborted }
+            constexpr void lock_emission() noexcept
             {
-                th->emission_aborted = false;
             }
 
-            ~abort_scope() noexcept
+            constexpr void unlock_emission() noexcept
             {
-                th->emission_aborted = prev;
             }
 
-            thread_local_data* th;
-            bool prev;
+            constexpr void swap(shared_lock_state&) noexcept
+            {
+            }
         };
 
-#ifndef ROCKET_NO_SMARTPOINTER_EXTENSIONS
-        template <class Instance, class Class, class R, class... Args>
-        struct weak_mem_fn final
+        template <>
+        struct shared_lock_state<thread_safe_policy> final
         {
-            explicit weak_mem_fn(std::weak_ptr<Instance> c, R (Class::*method)(Args...))
-                : weak{ std::move(c) }
-                , method{ method }
-            {
-            }
+            using threading_policy = thread_safe_policy;
 
-            template <class... Args1>
-            auto operator()(Args1&&... args) const
+            shared_lock_state()
+                : lock_primitive{ make_control_block() }
             {
-                if constexpr (std::is_void_v<R>)
-                {
-                    if (auto strong = weak.lock())
-                    {
-                        (strong.get()->*method)(std::forward<Args1>(args)...);
-                    }
-                }
-                else
-                {
-                    if (auto strong = weak.lock())
-                    {
-                        return optional<R>{ (strong.get()->*method)(std::forward<Args1>(args)...) };
-                    }
-                    return optional<R>{};
-                }
             }
 
-        private:
-            std::weak_ptr<Instance> weak;
-            R (Class::*method)(Args...);
-        };
+            ~shared_lock_state() = default;
 
-        template <class Instance, class Class, class R, class... Args>
-        struct shared_mem_fn final
-        {
-            explicit shared_mem_fn(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
-                : shared{ std::move(c) }
-                , method{ method }
+            shared_lock_state(shared_lock_state const& s)
+                : lock_primitive{ s.lock_primitive }
             {
             }
 
-            template <class... Args1>
-            R operator()(Args1&&... args) const
+            shared_lock_state(shared_lock_state&& s)
+                : lock_primitive{ std::move(s.lock_primitive) }
             {
-                return (shared.get()->*method)(std::forward<Args1>(args)...);
+                s.lock_primitive = make_control_block();
             }
 
-        private:
-            std::shared_ptr<Instance> shared;
-            R (Class::*method)(Args...);
-        };
-#endif//~ ROCKET_NO_SMARTPOINTER_EXTENSIONS
-    } // namespace detail
+            shared_lock_state& operator=(shared_lock_state const& rhs)
+            {
+                lock_primitive = rhs.lock_primitive;
+                return *this;
+            }
 
-#ifndef ROCKET_NO_SMARTPOINTER_EXTENSIONS
-    template <class Instance, class Class, class R, class... Args>
-    inline auto bind_weak_ptr(std::weak_ptr<Instance> c, R (Class::*method)(Args...))
-    {
-        return detail::weak_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
-    }
+            shared_lock_state& operator=(shared_lock_state&& rhs)
+            {
+                lock_primitive = std::move(rhs.lock_primitive);
+                rhs.lock_primitive = make_control_block();
+                return *this;
+            }
 
-    template <class Instance, class Class, class R, class... Args>
-    inline auto bind_weak_ptr(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
-    {
-        return detail::weak_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
-    }
+            void lock()
+            {
+                lock_primitive->mutex.lock();
+            }
 
-    template <class Instance, class Class, class R, class... Args>
-    inline auto bind_shared_ptr(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
-    {
-        return detail::shared_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
-    }
-#endif
+            bool try_lock()
+            {
+                return lock_primitive->mutex.try_lock();
+            }
 
-    struct connection
-    {
-        connection() noexcept
-            : base{ nullptr }
-            , is_thread_safe{ false }
-        {
-        }
+            void unlock()
+            {
+                lock_primitive->mutex.unlock();
+            }
 
-        ~connection() noexcept
-        {
-            release();
-        }
+            void lock_emission()
+            {
+                lock_primitive->mutex.lock();
+            }
 
-        connection(connection&& rhs) noexcept
-            : base{ rhs.base }
-            , is_thread_safe{ rhs.is_thread_safe }
-        {
-            rhs.base = nullptr;
-            rhs.is_thread_safe = false;
-        }
+            void unlock_emission()
+            {
+                lock_primitive->mutex.unlock();
+            }
 
-        connection(connection const& rhs) noexcept
-            : base{ rhs.base }
-            , is_thread_safe{ rhs.is_thread_safe }
-        {
-            addref();
-        }
+            void swap(shared_lock_state& s) noexcept
+            {
+                lock_primitive.swap(s.lock_primitive);
+            }
 
-        explicit connection(void* base, bool is_thread_safe) noexcept
-            : base{ base }
-            , is_thread_safe{ is_thread_safe }
-        {
-            addref();
-        }
+            intrusive_ptr<shared_lock> lock_primitive;
+        };
 
-        connection& operator=(connection&& rhs) noexcept
+        template <>
+        struct shared_lock_state<thread_safe_shared_policy> final
         {
-            release();
-            base = rhs.base;
-            is_thread_safe = rhs.is_thread_safe;
-            rhs.base = nullptr;
-            rhs.is_thread_safe = false;
-            return *this;
-        }
+            using threading_policy = thread_safe_shared_policy;
 
-        connection& operator=(connection const& rhs) noexcept
-        {
-            if (this != &rhs)
+            shared_lock_state()
+                : lock_primitive{ make_control_block() }
             {
-                release();
-                base = rhs.base;
-                is_thread_safe = rhs.is_thread_safe;
-                addref();
             }
-            return *this;
-        }
 
-        ROCKET_NODISCARD bool operator==(connection const& rhs) const noexcept
-        {
-            return base == rhs.base && is_thread_safe == rhs.is_thread_safe;
-        }
+            ~shared_lock_state() = default;
 
-        ROCKET_NODISCARD bool operator!=(connection const& rhs) const noexcept
-        {
-            return base != rhs.base || is_thread_safe != rhs.is_thread_safe;
-        }
+            shared_lock_state(shared_lock_state const& s)
+                : lock_primitive{ s.lock_primitive }
+            {
+            }
 
-        ROCKET_NODISCARD explicit operator bool() const noexcept
-        {
-            return is_connected();
-        }
+            shared_lock_state(shared_lock_state&& s)
+                : lock_primitive{ std::move(s.lock_primitive) }
+            {
+                s.lock_primitive = make_control_block();
+            }
 
-        ROCKET_NODISCARD bool is_connected() const noexcept
-        {
-            if (base != nullptr)
+            shared_lock_state& operator=(shared_lock_state const& rhs)
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    return std::launder(safe)->is_connected();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    return std::launder(unsafe)->is_connected();
-                }
+                lock_primitive = rhs.lock_primitive;
+                return *this;
             }
-            return false;
-        }
 
-#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-        ROCKET_NODISCARD bool is_blocked() const noexcept
-        {
-            if (base != nullptr)
+            shared_lock_state& operator=(shared_lock_state&& rhs)
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    return std::launder(safe)->is_blocked();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    return std::launder(unsafe)->is_blocked();
-                }
+                lock_primitive = std::move(rhs.lock_primitive);
+                rhs.lock_primitive = make_control_block();
+                return *this;
             }
-            return false;
-        }
 
-        void block() noexcept
-        {
-            if (base != nullptr)
+            void lock()
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    std::launder(safe)->block();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    std::launder(unsafe)->block();
-                }
+                lock_primitive->mutex.lock();
             }
-        }
 
-        void unblock() noexcept
-        {
-            if (base != nullptr)
+            bool try_lock()
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    std::launder(safe)->unblock();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    std::launder(unsafe)->unblock();
-                }
+                return lock_primitive->mutex.try_lock();
             }
-        }
-#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
 
-        void disconnect() noexcept
-        {
-            if (base != nullptr)
+            void unlock()
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    std::launder(safe)->disconnect();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    std::launder(unsafe)->disconnect();
-                }
-
-                release();
+                lock_primitive->mutex.unlock();
             }
-        }
 
-        void swap(connection& other) noexcept
-        {
-            if (this != &other)
+            void lock_emission()
             {
-                void* tmp_base{ base };
-                bool tmp_is_thread_safe{ is_thread_safe };
-                base = other.base;
-                is_thread_safe = other.is_thread_safe;
-                other.base = tmp_base;
-                other.is_thread_safe = tmp_is_thread_safe;
+                lock_primitive->mutex.lock_shared();
             }
-        }
-
-    private:
-        void* base;
-        bool is_thread_safe;
 
-        void addref() noexcept
-        {
-            if (base != nullptr)
+            void unlock_emission()
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    std::launder(safe)->addref();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    std::launder(unsafe)->addref();
-                }
+                lock_primitive->mutex.unlock_shared();
             }
-        }
 
-        void release() noexcept
-        {
-            if (base != nullptr)
+            void swap(shared_lock_state& s) noexcept
             {
-                if (is_thread_safe)
-                {
-                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
-                    std::launder(safe)->release();
-                }
-                else
-                {
-                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
-                    std::launder(unsafe)->release();
-                }
-
-                base = nullptr;
-                is_thread_safe = false;
+                lock_primitive.swap(s.lock_primitive);
             }
-        }
-    };
 
-    struct scoped_connection final : connection
-    {
-        scoped_connection() noexcept = default;
+            intrusive_ptr<shared_lock> lock_primitive;
+        };
 
-        ~scoped_connection() noexcept
+        template <>
+        struct shared_lock_state<thread_safe_rcu_policy> final
         {
-            disconnect();
-        }
+            using threading_policy = thread_safe_rcu_policy;
 
-        scoped_connection(connection const& rhs) noexcept
-            : connection{ rhs }
-        {
-        }
+            shared_lock_state()
+                : lock_primitive{ make_control_block() }
+            {
+            }
 
-        scoped_connection(connection&& rhs) noexcept
-            : connection{ std::move(rhs) }
-        {
-        }
+            ~shared_lock_state() = default;
 
-        scoped_connection(scoped_connection&& rhs) noexcept
-            : connection{ std::move(rhs) }
-        {
-        }
+            shared_lock_state(shared_lock_state const& s)
+                : lock_primitive{ s.lock_primitive }
+            {
+            }
 
-        scoped_connection& operator=(connection&& rhs) noexcept
-        {
-            disconnect();
+            shared_lock_state(shared_lock_state&& s)
+                : lock_primitive{ std::move(s.lock_primitive) }
+            {
+                s.lock_primitive = make_control_block();
+            }
 
-            connection::operator=(std::move(rhs));
-            return *this;
-        }
+            shared_lock_state& operator=(shared_lock_state const& rhs)
+            {
+                lock_primitive = rhs.lock_primitive;
+                return *this;
+            }
 
-        scoped_connection& operator=(scoped_connection&& rhs) noexcept
-        {
-            disconnect();
+            shared_lock_state& operator=(shared_lock_state&& rhs)
+            {
+                lock_primitive = std::move(rhs.lock_primitive);
+                rhs.lock_primitive = make_control_block();
+                return *this;
+            }
 
-            connection::operator=(std::move(rhs));
-            return *this;
-        }
+            void lock()
+            {
+                lock_primitive->mutex.lock();
+            }
 
-        scoped_connection& operator=(connection const& rhs) noexcept
-        {
-            disconnect();
+            bool try_lock()
+            {
+                return lock_primitive->mutex.try_lock();
+            }
 
-            connection::operator=(rhs);
-            return *this;
-        }
+            void unlock()
+            {
+                lock_primitive->mutex.unlock();
+            }
 
-    private:
-        scoped_connection(scoped_connection const&) = delete;
+            // Emission is lock free; only mutation takes the mutex.
+            constexpr void lock_emission() noexcept
+            {
+            }
 
-        scoped_connection& operator=(scoped_connection const&) = delete;
-    };
+            constexpr void unlock_emission() noexcept
+            {
+            }
 
-    struct scoped_connection_container final
-    {
-        scoped_connection_container() = default;
-        ~scoped_connection_container() = default;
+            void swap(shared_lock_state& s) noexcept
+            {
+                lock_primitive.swap(s.lock_primitive);
+            }
 
-        scoped_connection_container(scoped_connection_container&& s)
-            : connections{ std::move(s.connections) }
-        {
-        }
+            intrusive_ptr<shared_lock> lock_primitive;
+        };
 
-        scoped_connection_container& operator=(scoped_connection_container&& rhs)
-        {
-            connections = std::move(rhs.connections);
-            return *this;
-        }
+        template <class ThreadingPolicy>
+        struct connection_base;
 
-        scoped_connection_container(std::initializer_list<connection> list)
+        template <>
+        struct connection_base<thread_unsafe_policy>
+            : ref_counted<connection_base<thread_unsafe_policy>>
+            , node_allocation
         {
-            append(list);
-        }
+            using threading_policy = thread_unsafe_policy;
 
-        void append(connection const& conn)
-        {
-            connections.push_front(scoped_connection{ conn });
-        }
+            virtual ~connection_base() noexcept = default;
 
-        void append(std::initializer_list<connection> list)
-        {
-            for (auto const& connection : list)
+            ROCKET_NODISCARD bool is_connected() const noexcept
             {
-                append(connection);
+                return prev != nullptr;
             }
-        }
-
-        scoped_connection_container& operator+=(connection const& conn)
-        {
-            append(conn);
-            return *this;
-        }
 
-        scoped_connection_container& operator+=(std::initializer_list<connection> list)
-        {
-            for (auto const& connection : list)
+            void disconnect() noexcept
             {
-                append(connection);
+                if (prev != nullptr)
+                {
+                    next->prev = prev;
+                    prev->next = next;
+
+                    // To mark a connection as disconnected, just set its prev-link to null but
+                    // leave the next link alive so we can still traverse through the connections
+                    // if the slot gets disconnected during signal emit.
+                    prev = nullptr;
+                }
             }
-            return *this;
-        }
 
-        void disconnect() noexcept
-        {
-            connections.clear();
-        }
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            ROCKET_NODISCARD std::thread::id get_tid() const noexcept
+            {
+                return std::thread::id{};
+            }
 
-    private:
-        scoped_connection_container(scoped_connection_container const&) = delete;
-        scoped_connection_container& operator=(scoped_connection_container const&) = delete;
+            ROCKET_NODISCARD constexpr bool is_queued() const noexcept
+            {
+                return false;
+            }
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
 
-        std::forward_list<scoped_connection> connections;
-    };
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+            void block() noexcept
+            {
+                ++block_count;
+            }
 
-    struct trackable
-    {
-        void add_tracked_connection(connection const& conn)
-        {
-            container.append(conn);
-        }
+            void unblock() noexcept
+            {
+                if (block_count > 0)
+                {
+                    --block_count;
+                }
+            }
 
-        void disconnect_tracked_connections() noexcept
-        {
-            container.disconnect();
-        }
+            ROCKET_NODISCARD bool is_blocked() const noexcept
+            {
+                return block_count > 0;
+            }
 
-    private:
-        scoped_connection_container container;
-    };
+            unsigned long block_count{ 0 };
+#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
 
-    ROCKET_NODISCARD inline connection current_connection() noexcept
-    {
-        auto th = detail::get_thread_local_data();
-        return connection{ th->current_connection, th->is_thread_safe_connection };
-    }
-
-    inline void abort_emission() noexcept
-    {
-        detail::get_thread_local_data()->emission_aborted = true;
-    }
-
-#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-    struct scoped_connection_blocker final
-    {
-        scoped_connection_blocker(connection c) noexcept
-            : conn{ std::move(c) }
-        {
-            conn.block();
-        }
+            intrusive_ptr<connection_base> next;
+            intrusive_ptr<connection_base> prev;
+        };
 
-        ~scoped_connection_blocker() noexcept
+        template <>
+        struct connection_base<thread_safe_policy>
+            : ref_counted<connection_base<thread_safe_policy>, ref_count_atomic>
+            , node_allocation
         {
-            conn.unblock();
-        }
-
-    private:
-        scoped_connection_blocker(scoped_connection_blocker const&) = delete;
-        scoped_connection_blocker& operator=(scoped_connection_blocker const&) = delete;
-
-        connection conn;
-    };
-#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+            using threading_policy = thread_safe_policy;
 
-    namespace detail
-    {
-#ifndef ROCKET_NO_TIMERS
-        struct timer_queue final
-        {
-            using slot_type = std::function<void()>;
+            virtual ~connection_base() noexcept = default;
 
-            timer_queue()
+            ROCKET_NODISCARD bool is_connected() const noexcept
             {
-                init();
+                return connected_state.load(std::memory_order_acquire);
             }
 
-            ~timer_queue() noexcept
+            void disconnect() noexcept
             {
-                destroy();
+                // The flag flips first, without the lock: emitters check it
+                // with acquire loads, so the slot stops firing the moment the
+                // exchange lands instead of once in-flight emissions drain.
+                // Only the physical unlink below still takes the exclusive
+                // side, since it mutates the list structure.
+                if (connected_state.exchange(false, std::memory_order_acq_rel))
+                {
+                    std::scoped_lock<std::shared_mutex> guard{ lock->mutex };
+                    unlink();
+                }
             }
 
-            timer_queue(timer_queue&& q)
-                : head{ std::move(q.head) }
-                , tail{ std::move(q.tail) }
+            // Callers must hold the shared lock's mutex exclusively.
+            void disconnect_without_lock() noexcept
             {
-                q.init();
+                connected_state.store(false, std::memory_order_release);
+                unlink();
             }
 
-            timer_queue(timer_queue const& q)
+            // Callers must hold the shared lock's mutex exclusively.
+            void unlink() noexcept
             {
-                init();
-                copy(q);
-            }
+                if (prev != nullptr)
+                {
+                    next->prev = prev;
+                    prev->next = next;
 
-            timer_queue& operator=(timer_queue&& rhs)
-            {
-                destroy();
-                head = std::move(rhs.head);
-                tail = std::move(rhs.tail);
-                rhs.init();
-                return *this;
+                    // To mark a connection as disconnected, just set its prev-link to null but
+                    // leave the next link alive so we can still traverse through the connections
+                    // if the slot gets disconnected during signal emit.
+                    prev = nullptr;
+                    bump_generation(lock);
+                }
             }
 
-            timer_queue& operator=(timer_queue const& rhs)
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            ROCKET_NODISCARD std::thread::id const& get_tid() const noexcept
             {
-                if (this != &rhs)
-                {
-                    clear();
-                    copy(rhs);
-                }
-                return *this;
+                return thread_id;
             }
 
-            template <class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(slot_type slot, std::chrono::duration<Rep, Period> const& interval)
+            ROCKET_NODISCARD bool is_queued() const noexcept
             {
-                assert(slot != nullptr);
-
-                auto expires_at = std::chrono::steady_clock::now() + interval;
-                auto interval_microsecs = std::chrono::duration_cast<std::chrono::microseconds>(interval);
-                connection_base* base
-                    = make_link(tail, std::move(slot), std::move(expires_at), std::move(interval_microsecs));
-                return connection{ static_cast<void*>(base), false };
+                return executor != nullptr || any_thread
+                    || (thread_id != std::thread::id{} && thread_id != std::this_thread::get_id());
             }
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
 
-            template <auto Method, class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(std::chrono::duration<Rep, Period> const& interval)
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+            // Blocking state is toggled with plain atomics - no lock - so a
+            // control thread flipping subscribers never contends with the
+            // emission path reading the count.
+            void block() noexcept
             {
-                return set_interval<Rep, Period>([] { (*Method)(); }, interval);
+                block_count.fetch_add(1, std::memory_order_release);
             }
 
-            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(
-                Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+            void unblock() noexcept
             {
-                connection c{ set_interval<Rep, Period>([&object, method] { (object.*method)(); }, interval) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                unsigned long count = block_count.load(std::memory_order_relaxed);
+                while (count != 0
+                       && !block_count.compare_exchange_weak(
+                           count, count - 1, std::memory_order_release, std::memory_order_relaxed))
                 {
-                    static_cast<trackable&>(object).add_tracked_connection(c);
                 }
-                return c;
             }
 
-            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(Instance& object, std::chrono::duration<Rep, Period> const& interval)
+            ROCKET_NODISCARD bool is_blocked() const noexcept
             {
-                connection c{ set_interval<Rep, Period>([&object] { (object.*Method)(); }, interval) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable&>(object).add_tracked_connection(c);
-                }
-                return c;
+                return block_count.load(std::memory_order_acquire) > 0;
             }
 
-            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(
-                Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+            std::atomic<unsigned long> block_count{ 0 };
+#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+
+            intrusive_ptr<connection_base> next;
+            intrusive_ptr<connection_base> prev;
+
+            intrusive_ptr<shared_lock> lock;
+
+            // Mirrors the prev-link so lock-free emission paths can check
+            // liveness without touching the list structure.
+            std::atomic<bool> connected_state{ true };
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            std::thread::id thread_id;
+
+            // Lane index in the call queue: 0 high, 1 normal, 2 low.
+            unsigned int queue_priority{ 1 };
+
+            // Queued emissions go to the shared any-thread pool instead of
+            // the connecting thread's queue.
+            bool any_thread{ false };
+
+            // When set, queued emissions for this slot bypass the global call
+            // queue and are handed to this sink instead.
+            slot_function<void(task_function)> executor;
+#endif
+        };
+
+        struct signal_control_block;
+
+        // List anchor embedded in the control block. The deleting destructor
+        // selects the deallocation function from the most derived class, so
+        // when the last reference to a sentinel drops it releases its pin on
+        // the block instead of freeing anything itself.
+        struct control_sentinel final : connection_base<thread_safe_policy>
+        {
+            static void* operator new(std::size_t, void* ptr) noexcept
             {
-                connection c{ set_interval<Rep, Period>([object, method] { (object->*method)(); }, interval) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable*>(object)->add_tracked_connection(c);
-                }
-                return c;
+                return ptr;
             }
 
-            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-            connection set_interval(Instance* object, std::chrono::duration<Rep, Period> const& interval)
+            static void operator delete(void*, void*) noexcept
             {
-                connection c{ set_interval<Rep, Period>([object] { (object->*Method)(); }, interval) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable*>(object)->add_tracked_connection(c);
-                }
-                return c;
             }
 
-            template <class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(slot_type slot, std::chrono::duration<Rep, Period> const& timeout)
-            {
-                assert(slot != nullptr);
+            static void operator delete(void* ptr) noexcept;
+        };
 
-                auto expires_at = std::chrono::steady_clock::now() + timeout;
-                connection_base* base
-                    = make_link(tail, std::move(slot), std::move(expires_at), std::chrono::microseconds(-1));
-                return connection{ static_cast<void*>(base), false };
-            }
+        // The hot per-signal shared state of a thread safe signal in one
+        // cache-line-aligned allocation: the mutex (through the shared_lock
+        // base every connection node keeps alive), the two list anchor
+        // sentinels and the mutation generation counter. One emission pulls
+        // one allocation's cache lines instead of three scattered ones, the
+        // mutex can't false-share with unrelated heap neighbours, and signal
+        // construction is a single allocation.
+        struct alignas(64) signal_control_block final : shared_lock
+        {
+            struct sentinel_slot final
+            {
+                signal_control_block* owner;
+                alignas(control_sentinel) unsigned char storage[sizeof(control_sentinel)];
+            };
 
-            template <auto Method, class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(std::chrono::duration<Rep, Period> const& timeout)
+            signal_control_block()
             {
-                return set_timeout<Rep, Period>([] { (*Method)(); }, timeout);
+                head_slot.owner = this;
+                tail_slot.owner = this;
+                // Each live sentinel pins the block; the matching release
+                // happens in control_sentinel::operator delete.
+                addref();
+                addref();
+                new (static_cast<void*>(head_slot.storage)) control_sentinel;
+                new (static_cast<void*>(tail_slot.storage)) control_sentinel;
             }
 
-            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(
-                Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+            ROCKET_NODISCARD connection_base<thread_safe_policy>* head() noexcept
             {
-                connection c{ set_timeout<Rep, Period>([&object, method] { (object.*method)(); }, timeout) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable&>(object).add_tracked_connection(c);
-                }
-                return c;
+                return std::launder(reinterpret_cast<control_sentinel*>(head_slot.storage));
             }
 
-            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(Instance& object, std::chrono::duration<Rep, Period> const& timeout)
+            ROCKET_NODISCARD connection_base<thread_safe_policy>* tail() noexcept
             {
-                connection c{ set_timeout<Rep, Period>([&object] { (object.*Method)(); }, timeout) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable&>(object).add_tracked_connection(c);
-                }
-                return c;
+                return std::launder(reinterpret_cast<control_sentinel*>(tail_slot.storage));
             }
 
-            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(
-                Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+            // Bumped under the exclusive lock by every structural mutation;
+            // diagnostics can sample it to spot churn without walking the
+            // list.
+            std::atomic<unsigned long> generation{ 0 };
+
+            sentinel_slot head_slot;
+            sentinel_slot tail_slot;
+        };
+
+        inline void control_sentinel::operator delete(void* ptr) noexcept
+        {
+            signal_control_block::sentinel_slot* slot
+                = reinterpret_cast<signal_control_block::sentinel_slot*>(
+                    static_cast<unsigned char*>(ptr)
+                    - offsetof(signal_control_block::sentinel_slot, storage));
+            slot->owner->release();
+        }
+
+        ROCKET_NODISCARD inline shared_lock* make_control_block()
+        {
+            return new signal_control_block;
+        }
+
+        inline void bump_generation(shared_lock* lock) noexcept
+        {
+            if (lock != nullptr)
             {
-                connection c{ set_timeout<Rep, Period>([object, method] { (object->*method)(); }, timeout) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
-                {
-                    static_cast<trackable*>(object)->add_tracked_connection(c);
-                }
-                return c;
+                static_cast<signal_control_block*>(lock)->generation.fetch_add(
+                    1, std::memory_order_relaxed);
             }
+        }
 
-            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-            connection set_timeout(Instance* object, std::chrono::duration<Rep, Period> const& timeout)
+        template <class ThreadingPolicy, class T>
+        struct functional_connection : connection_base<ThreadingPolicy>
+        {
+            slot_function<T> slot;
+
+#ifndef ROCKET_NO_TARGET_INDEX
+            // Address of the object this slot was connected to through one of
+            // the object-targeted connect overloads; null for free slots. Lets
+            // signal::copy rebuild the target index of the copied signal.
+            void const* target{ nullptr };
+#endif
+        };
+
+        // A flat, ref-counted snapshot of the connection list used as the read
+        // path during emission. The intrusive list stays the mutation
+        // structure; the snapshot is rebuilt lazily once a connect or an
+        // observed disconnect has invalidated it, so the hot emit loop is a
+        // linear scan over contiguous memory instead of a pointer chase.
+        // Emissions keep their snapshot alive through its ref-count, which
+        // makes reentrant and concurrent emissions safe against rebuilds.
+        template <class ThreadingPolicy>
+        struct connection_snapshot final
+            : ref_counted<
+                  connection_snapshot<ThreadingPolicy>,
+                  std::conditional_t<ThreadingPolicy::is_thread_safe, ref_count_atomic, ref_count>>
+        {
+            std::vector<intrusive_ptr<connection_base<ThreadingPolicy>>> connections;
+
+            // Chains superseded snapshots awaiting grace-period reclamation
+            // under thread_safe_rcu_policy; unused by the other policies.
+            intrusive_ptr<connection_snapshot> retired_next;
+        };
+
+        // Read-side state for thread_safe_rcu_policy signals: emitters bump
+        // the active counter, read one atomic snapshot pointer and never
+        // touch a lock or a ref-count. Mutators - always under the signal's
+        // exclusive lock - publish replacement snapshots and retire old ones
+        // until no emission is in flight.
+        template <class Snapshot, bool Enabled>
+        struct rcu_emission_state final
+        {
+        };
+
+        template <class Snapshot>
+        struct rcu_emission_state<Snapshot, true> final
+        {
+            ~rcu_emission_state() noexcept
             {
-                connection c{ set_timeout<Rep, Period>([object] { (object->*Method)(); }, timeout) };
-                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                if (Snapshot* current = reader.exchange(nullptr, std::memory_order_relaxed))
                 {
-                    static_cast<trackable*>(object)->add_tracked_connection(c);
+                    current->release();
                 }
-                return c;
             }
 
-            void clear() noexcept
+            // Publishes the next read snapshot (may be null) and retires the
+            // previous one; callers must hold the signal's exclusive lock.
+            void publish(intrusive_ptr<Snapshot> next) noexcept
             {
-                intrusive_ptr<connection_base> current{ head->next };
-                while (current != tail)
+                Snapshot* old = reader.exchange(next.detach(), std::memory_order_seq_cst);
+                if (old != nullptr)
                 {
-                    intrusive_ptr<connection_base> next{ current->next };
-                    current->next = tail;
-                    current->prev = nullptr;
-                    current = std::move(next);
+                    if (active.load(std::memory_order_seq_cst) == 0)
+                    {
+                        // No emission in flight: the old snapshot and
+                        // everything retired before it can go at once.
+                        retired = nullptr;
+                        old->release();
+                    }
+                    else
+                    {
+                        // Chain it up; a later mutation reclaims it once the
+                        // readers have drained.
+                        old->retired_next = std::move(retired);
+                        retired = intrusive_ptr<Snapshot>{ old };
+                        old->release();
+                    }
                 }
-
-                head->next = tail;
-                tail->prev = head;
-            }
-
-            void swap(timer_queue& other) noexcept
-            {
-                if (this != &other)
+                else if (retired != nullptr && active.load(std::memory_order_seq_cst) == 0)
                 {
-                    head.swap(other.head);
-                    tail.swap(other.tail);
+                    retired = nullptr;
                 }
             }
 
-            bool dispatch(std::chrono::time_point<std::chrono::steady_clock> execute_until)
-            {
-#    ifndef ROCKET_NO_EXCEPTIONS
-                bool error{ false };
-#    endif
-                bool not_enough_time{ false };
-                std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
-                {
-                    detail::thread_local_data* th{ detail::get_thread_local_data() };
-                    detail::abort_scope ascope{ th };
-
-                    intrusive_ptr<connection_base> current{ head->next };
-                    intrusive_ptr<connection_base> end{ tail };
-
-                    while (current != end)
-                    {
-                        assert(current != nullptr);
-
-                        if (current->prev != nullptr
-#    ifndef ROCKET_NO_BLOCKING_CONNECTIONS
-                            && current->block_count == 0
-#    endif
-                        )
-                            ROCKET_LIKELY
-                            {
-                                detail::connection_scope cscope{ current, false, th };
-
-                                timed_connection* conn
-                                    = std::launder(static_cast<timed_connection*>(static_cast<void*>(current)));
-
-                                if (conn->expires_at <= now)
-                                {
-                                    if (conn->interval.count() < 0)
-                                    {
-                                        conn->disconnect();
-                                    }
-                                    else
-                                    {
-                                        conn->expires_at = now + conn->interval;
-                                    }
-#    ifndef ROCKET_NO_EXCEPTIONS
-                                    try
-                                    {
-#    endif
-                                        conn->slot();
-#    ifndef ROCKET_NO_EXCEPTIONS
-                                    }
-                                    catch (...)
-                                    {
-                                        error = true;
-                                    }
-#    endif
-                                    if (execute_until != std::chrono::time_point<std::chrono::steady_clock>{})
-                                        ROCKET_UNLIKELY
-                                        {
-                                            // Check if we already spent the maximum allowed time executing callbacks
-                                            if (execute_until <= std::chrono::steady_clock::now())
-                                            {
-                                                not_enough_time = true;
-                                                break;
-                                            }
-                                        }
-
-                                    if (th->emission_aborted)
-                                        ROCKET_UNLIKELY
-                                        {
-                                            break;
-                                        }
-                                }
-                            }
-
-                        current = current->next;
-                    }
-                }
+            std::atomic<Snapshot*> reader{ nullptr };
+            std::atomic<long> active{ 0 };
+            intrusive_ptr<Snapshot> retired;
+        };
 
-#    ifndef ROCKET_NO_EXCEPTIONS
-                if (error)
-                    ROCKET_UNLIKELY
-                    {
-                        throw invocation_slot_error{};
-                    }
-#    endif
-                return not_enough_time;
-            }
+#ifndef ROCKET_NO_TIMERS
+        struct timed_connection final : functional_connection<thread_unsafe_policy, void()>
+        {
+            std::chrono::time_point<std::chrono::steady_clock> expires_at;
+            std::chrono::microseconds interval;
+        };
+#endif
+        // Should make sure that this is POD
+        struct thread_local_data final
+        {
+            void* current_connection;
+            bool is_thread_safe_connection;
+            bool emission_aborted;
+        };
 
-        private:
-            using connection_base = detail::connection_base<thread_unsafe_policy>;
+        ROCKET_NODISCARD inline thread_local_data* get_thread_local_data() noexcept
+        {
+            static ROCKET_THREAD_LOCAL thread_local_data th;
+            return &th;
+        }
 
-            void init()
+        struct connection_scope final
+        {
+            connection_scope(void* base, bool is_thread_safe, thread_local_data* th) noexcept
+                : th{ th }
+                , prev{ th->current_connection }
+                , prevThreadSafe{ th->is_thread_safe_connection }
             {
-                head = new connection_base;
-                tail = new connection_base;
-                head->next = tail;
-                tail->prev = head;
+                th->current_connection = base;
+                th->is_thread_safe_connection = is_thread_safe;
             }
 
-            void destroy() noexcept
+            ~connection_scope() noexcept
             {
-                clear();
-                head->next = nullptr;
-                tail->prev = nullptr;
+                th->current_connection = prev;
+                th->is_thread_safe_connection = prevThreadSafe;
             }
 
-            void copy(timer_queue const& q)
-            {
-                intrusive_ptr<connection_base> current{ q.head->next };
-                intrusive_ptr<connection_base> end{ q.tail };
-
-                while (current != end)
-                {
-                    timed_connection* conn = std::launder(static_cast<timed_connection*>(static_cast<void*>(current)));
+            thread_local_data* th;
+            void* prev;
+            bool prevThreadSafe;
+        };
 
-                    make_link(tail, conn->slot, conn->expires_at, conn->interval);
-                    current = current->next;
-                }
+        struct abort_scope final
+        {
+            abort_scope(thread_local_data* th) noexcept
+                : th{ th }
+                , prev{ th->emission_aborted }
+            {
+                th->emission_aborted = false;
             }
 
-            timed_connection* make_link(
-                connection_base* l,
-                slot_type slot,
-                std::chrono::time_point<std::chrono::steady_clock> expires_at,
-                std::chrono::microseconds interval)
+            ~abort_scope() noexcept
             {
-                intrusive_ptr<timed_connection> link{ new timed_connection };
-                link->slot = std::move(slot);
-                link->expires_at = std::move(expires_at);
-                link->interval = std::move(interval);
-                link->prev = l->prev;
-                link->next = l;
-                link->prev->next = link;
-                link->next->prev = link;
-                return link;
+                th->emission_aborted = prev;
             }
 
-            intrusive_ptr<connection_base> head;
-            intrusive_ptr<connection_base> tail;
+            thread_local_data* th;
+            bool prev;
         };
 
-        inline timer_queue* get_timer_queue() noexcept
-        {
-            static ROCKET_THREAD_LOCAL timer_queue queue;
-            return &queue;
-        }
-
-#endif//~ ROCKET_NO_TIMERS
-
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-        struct call_queue final
+#ifndef ROCKET_NO_SMARTPOINTER_EXTENSIONS
+        template <class Instance, class Class, class R, class... Args>
+        struct weak_mem_fn final
         {
-            void put(std::thread::id tid, std::packaged_task<void()> task)
+            explicit weak_mem_fn(std::weak_ptr<Instance> c, R (Class::*method)(Args...))
+                : weak{ std::move(c) }
+                , method{ method }
             {
-                std::scoped_lock<std::mutex> guard{ mutex };
-                queue[tid].emplace_back(std::move(task));
             }
 
-            bool dispatch(std::chrono::time_point<std::chrono::steady_clock> execute_until)
+            template <class... Args1>
+            auto operator()(Args1&&... args) const
             {
-                std::thread::id tid = std::this_thread::get_id();
-                std::deque<std::packaged_task<void()>> thread_queue;
-
+                if constexpr (std::is_void_v<R>)
                 {
-                    std::scoped_lock<std::mutex> guard{ mutex };
-
-                    auto iterator = queue.find(tid);
-                    if (iterator != queue.end())
+                    if (auto strong = weak.lock())
                     {
-                        thread_queue.swap(iterator->second);
-                        queue.erase(iterator);
+                        (strong.get()->*method)(std::forward<Args1>(args)...);
                     }
                 }
-
-                auto itr = thread_queue.begin();
-                auto end = thread_queue.end();
-
-                while (itr != end)
+                else
                 {
-                    (itr++)->operator()();
-
-                    if (execute_until != std::chrono::time_point<std::chrono::steady_clock>{})
-                        ROCKET_UNLIKELY
-                        {
-                            // check if we already spent the maximum allowed time executing callbacks
-                            if (execute_until <= std::chrono::steady_clock::now())
-                            {
-                                break;
-                            }
-                        }
-                }
-
-                if (itr != end)
-                    ROCKET_UNLIKELY
+                    if (auto strong = weak.lock())
                     {
-                        // readd unfinished work to the queue
-                        auto rbegin = std::make_reverse_iterator(end);
-                        auto rend = std::make_reverse_iterator(itr);
-
-                        std::scoped_lock<std::mutex> guard{ mutex };
-                        std::deque<std::packaged_task<void()>>& original_queue = queue[tid];
-
-                        for (auto it = rbegin; it != rend; ++it)
-                        {
-                            original_queue.push_front(std::move(*it));
-                        }
+                        return optional<R>{ (strong.get()->*method)(std::forward<Args1>(args)...) };
                     }
-                return itr != end;
+                    return optional<R>{};
+                }
             }
 
         private:
-            std::mutex mutex;
-            std::unordered_map<std::thread::id, std::deque<std::packaged_task<void()>>> queue;
+            std::weak_ptr<Instance> weak;
+            R (Class::*method)(Args...);
         };
 
-        inline call_queue* get_call_queue() noexcept
-        {
-            static call_queue queue;
-            return &queue;
-        }
-
-        template <class T>
-        struct decay
+        template <class Instance, class Class, class R, class... Args>
+        struct shared_mem_fn final
         {
-            typedef typename std::remove_reference<T>::type U;
-            typedef typename std::conditional<
-                std::is_array<U>::value,
-                typename std::remove_extent<U>::type*,
-                typename std::conditional<
-                    std::is_function<U>::value,
-                    typename std::add_pointer<U>::type,
-                    typename std::conditional<
-                        std::is_const<U>::value || !std::is_reference<T>::value,
-                        typename std::remove_cv<U>::type,
-                        T>::type>::type>::type type;
-        };
+            explicit shared_mem_fn(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
+                : shared{ std::move(c) }
+                , method{ method }
+            {
+            }
 
-        template <class T>
-        struct unwrap_refwrapper
-        {
-            using type = T;
-        };
+            template <class... Args1>
+            R operator()(Args1&&... args) const
+            {
+                return (shared.get()->*method)(std::forward<Args1>(args)...);
+            }
 
-        template <class T>
-        struct unwrap_refwrapper<std::reference_wrapper<T>>
-        {
-            using type = T&;
+        private:
+            std::shared_ptr<Instance> shared;
+            R (Class::*method)(Args...);
         };
+#endif//~ ROCKET_NO_SMARTPOINTER_EXTENSIONS
+    } // namespace detail
 
-        template <class T>
-        using special_decay_t = typename unwrap_refwrapper<typename decay<T>::type>::type;
-
-        // This make_tuple implementation is different from std::make_tuple.
-        // This one preserves non-const references as actual reference values.
-        // However const references will be stored by value.
+#ifndef ROCKET_NO_SMARTPOINTER_EXTENSIONS
+    template <class Instance, class Class, class R, class... Args>
+    inline auto bind_weak_ptr(std::weak_ptr<Instance> c, R (Class::*method)(Args...))
+    {
+        return detail::weak_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
+    }
 
-        // make_tuple(int const&) => tuple<int>
-        // make_tuple(int&) => tuple<int&>
+    template <class Instance, class Class, class R, class... Args>
+    inline auto bind_weak_ptr(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
+    {
+        return detail::weak_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
+    }
+
+    template <class Instance, class Class, class R, class... Args>
+    inline auto bind_shared_ptr(std::shared_ptr<Instance> c, R (Class::*method)(Args...))
+    {
+        return detail::shared_mem_fn<Instance, Class, R, Args...>{ std::move(c), method };
+    }
+#endif
+
+    template <std::size_t InlineCapacity>
+    struct basic_scoped_connection_container;
+
+    struct connection
+    {
+        template <std::size_t InlineCapacity>
+        friend struct basic_scoped_connection_container;
+
+#ifndef ROCKET_NO_TARGET_INDEX
+        // The owning signal registers object-targeted connections in its
+        // target index and needs to see the underlying node for that.
+        template <class Signature, class Collector, class ThreadingPolicy>
+        friend struct signal;
+#endif
+
+        connection() noexcept
+            : base{ nullptr }
+            , is_thread_safe{ false }
+        {
+        }
+
+        ~connection() noexcept
+        {
+            release();
+        }
+
+        connection(connection&& rhs) noexcept
+            : base{ rhs.base }
+            , is_thread_safe{ rhs.is_thread_safe }
+        {
+            rhs.base = nullptr;
+            rhs.is_thread_safe = false;
+        }
+
+        connection(connection const& rhs) noexcept
+            : base{ rhs.base }
+            , is_thread_safe{ rhs.is_thread_safe }
+        {
+            addref();
+        }
+
+        explicit connection(void* base, bool is_thread_safe) noexcept
+            : base{ base }
+            , is_thread_safe{ is_thread_safe }
+        {
+            addref();
+        }
+
+        connection& operator=(connection&& rhs) noexcept
+        {
+            release();
+            base = rhs.base;
+            is_thread_safe = rhs.is_thread_safe;
+            rhs.base = nullptr;
+            rhs.is_thread_safe = false;
+            return *this;
+        }
+
+        connection& operator=(connection const& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                release();
+                base = rhs.base;
+                is_thread_safe = rhs.is_thread_safe;
+                addref();
+            }
+            return *this;
+        }
+
+        ROCKET_NODISCARD bool operator==(connection const& rhs) const noexcept
+        {
+            return base == rhs.base && is_thread_safe == rhs.is_thread_safe;
+        }
+
+        ROCKET_NODISCARD bool operator!=(connection const& rhs) const noexcept
+        {
+            return base != rhs.base || is_thread_safe != rhs.is_thread_safe;
+        }
+
+        ROCKET_NODISCARD explicit operator bool() const noexcept
+        {
+            return is_connected();
+        }
+
+        ROCKET_NODISCARD bool is_connected() const noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    return std::launder(safe)->is_connected();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    return std::launder(unsafe)->is_connected();
+                }
+            }
+            return false;
+        }
+
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+        ROCKET_NODISCARD bool is_blocked() const noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    return std::launder(safe)->is_blocked();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    return std::launder(unsafe)->is_blocked();
+                }
+            }
+            return false;
+        }
+
+        void block() noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    std::launder(safe)->block();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    std::launder(unsafe)->block();
+                }
+            }
+        }
+
+        void unblock() noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    std::launder(safe)->unblock();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    std::launder(unsafe)->unblock();
+                }
+            }
+        }
+#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+
+        void disconnect() noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    std::launder(safe)->disconnect();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    std::launder(unsafe)->disconnect();
+                }
+
+                release();
+            }
+        }
+
+        void swap(connection& other) noexcept
+        {
+            if (this != &other)
+            {
+                void* tmp_base{ base };
+                bool tmp_is_thread_safe{ is_thread_safe };
+                base = other.base;
+                is_thread_safe = other.is_thread_safe;
+                other.base = tmp_base;
+                other.is_thread_safe = tmp_is_thread_safe;
+            }
+        }
+
+    private:
+        void* base;
+        bool is_thread_safe;
+
+        void addref() noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    std::launder(safe)->addref();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    std::launder(unsafe)->addref();
+                }
+            }
+        }
+
+        void release() noexcept
+        {
+            if (base != nullptr)
+            {
+                if (is_thread_safe)
+                {
+                    auto safe{ static_cast<detail::connection_base<thread_safe_policy>*>(base) };
+                    std::launder(safe)->release();
+                }
+                else
+                {
+                    auto unsafe{ static_cast<detail::connection_base<thread_unsafe_policy>*>(base) };
+                    std::launder(unsafe)->release();
+                }
+
+                base = nullptr;
+                is_thread_safe = false;
+            }
+        }
+    };
+
+    struct scoped_connection final : connection
+    {
+        scoped_connection() noexcept = default;
+
+        ~scoped_connection() noexcept
+        {
+            disconnect();
+        }
+
+        scoped_connection(connection const& rhs) noexcept
+            : connection{ rhs }
+        {
+        }
+
+        scoped_connection(connection&& rhs) noexcept
+            : connection{ std::move(rhs) }
+        {
+        }
+
+        scoped_connection(scoped_connection&& rhs) noexcept
+            : connection{ std::move(rhs) }
+        {
+        }
+
+        scoped_connection& operator=(connection&& rhs) noexcept
+        {
+            disconnect();
+
+            connection::operator=(std::move(rhs));
+            return *this;
+        }
+
+        scoped_connection& operator=(scoped_connection&& rhs) noexcept
+        {
+            disconnect();
+
+            connection::operator=(std::move(rhs));
+            return *this;
+        }
+
+        scoped_connection& operator=(connection const& rhs) noexcept
+        {
+            disconnect();
+
+            connection::operator=(rhs);
+            return *this;
+        }
+
+    private:
+        scoped_connection(scoped_connection const&) = delete;
+
+        scoped_connection& operator=(scoped_connection const&) = delete;
+    };
+
+    // Holds its first InlineCapacity connections in-place - no heap node per
+    // tracked connection - and spills the rest into a vector. disconnect()
+    // groups thread safe connections by their owning signal's lock, so each
+    // lock is taken once instead of once per connection.
+    template <std::size_t InlineCapacity>
+    struct basic_scoped_connection_container final
+    {
+        basic_scoped_connection_container() = default;
+
+        ~basic_scoped_connection_container()
+        {
+            disconnect();
+        }
+
+        basic_scoped_connection_container(basic_scoped_connection_container&& s)
+            : overflow{ std::move(s.overflow) }
+        {
+            for (std::size_t index = 0; index < s.inline_count; ++index)
+            {
+                new (inline_storage_at(index)) scoped_connection{ std::move(*s.inline_element(index)) };
+                s.inline_element(index)->~scoped_connection();
+            }
+            inline_count = s.inline_count;
+            s.inline_count = 0;
+        }
+
+        basic_scoped_connection_container& operator=(basic_scoped_connection_container&& rhs)
+        {
+            if (this != &rhs)
+            {
+                disconnect();
+                overflow = std::move(rhs.overflow);
+                for (std::size_t index = 0; index < rhs.inline_count; ++index)
+                {
+                    new (inline_storage_at(index)) scoped_connection{ std::move(*rhs.inline_element(index)) };
+                    rhs.inline_element(index)->~scoped_connection();
+                }
+                inline_count = rhs.inline_count;
+                rhs.inline_count = 0;
+            }
+            return *this;
+        }
+
+        basic_scoped_connection_container(std::initializer_list<connection> list)
+        {
+            append(list);
+        }
+
+        void append(connection const& conn)
+        {
+            if (inline_count < InlineCapacity)
+            {
+                new (inline_storage_at(inline_count)) scoped_connection{ conn };
+                ++inline_count;
+            }
+            else
+            {
+                overflow.emplace_back(conn);
+            }
+        }
+
+        void append(std::initializer_list<connection> list)
+        {
+            for (auto const& connection : list)
+            {
+                append(connection);
+            }
+        }
+
+        basic_scoped_connection_container& operator+=(connection const& conn)
+        {
+            append(conn);
+            return *this;
+        }
+
+        basic_scoped_connection_container& operator+=(std::initializer_list<connection> list)
+        {
+            for (auto const& connection : list)
+            {
+                append(connection);
+            }
+            return *this;
+        }
+
+        void disconnect() noexcept
+        {
+            using safe_base = detail::connection_base<thread_safe_policy>;
+            using unsafe_base = detail::connection_base<thread_unsafe_policy>;
+
+            std::size_t const count = size();
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                connection& current = element(index);
+                if (current.base == nullptr)
+                {
+                    continue;
+                }
+
+                if (!current.is_thread_safe)
+                {
+                    std::launder(static_cast<unsafe_base*>(current.base))->disconnect();
+                    current.release();
+                    continue;
+                }
+
+                // Take this signal's lock once and unlink every remaining
+                // tracked connection that shares it.
+                safe_base* node = std::launder(static_cast<safe_base*>(current.base));
+                intrusive_ptr<detail::shared_lock> lock{ node->lock };
+
+                std::scoped_lock<std::shared_mutex> guard{ lock->mutex };
+                for (std::size_t peer = index; peer < count; ++peer)
+                {
+                    connection& candidate = element(peer);
+                    if (candidate.base != nullptr && candidate.is_thread_safe)
+                    {
+                        safe_base* peer_node = std::launder(static_cast<safe_base*>(candidate.base));
+                        if (peer_node->lock == lock)
+                        {
+                            peer_node->disconnect_without_lock();
+                            candidate.release();
+                        }
+                    }
+                }
+            }
+
+            for (std::size_t index = 0; index < inline_count; ++index)
+            {
+                inline_element(index)->~scoped_connection();
+            }
+            inline_count = 0;
+            overflow.clear();
+        }
+
+    private:
+        basic_scoped_connection_container(basic_scoped_connection_container const&) = delete;
+        basic_scoped_connection_container& operator=(basic_scoped_connection_container const&) = delete;
+
+        ROCKET_NODISCARD std::size_t size() const noexcept
+        {
+            return inline_count + overflow.size();
+        }
+
+        ROCKET_NODISCARD scoped_connection& element(std::size_t index) noexcept
+        {
+            return index < inline_count ? *inline_element(index) : overflow[index - inline_count];
+        }
+
+        ROCKET_NODISCARD scoped_connection* inline_element(std::size_t index) noexcept
+        {
+            return std::launder(reinterpret_cast<scoped_connection*>(inline_storage_at(index)));
+        }
+
+        ROCKET_NODISCARD void* inline_storage_at(std::size_t index) noexcept
+        {
+            return static_cast<void*>(inline_storage + index * sizeof(scoped_connection));
+        }
+
+        alignas(scoped_connection) std::byte inline_storage[InlineCapacity * sizeof(scoped_connection)];
+        std::size_t inline_count{ 0 };
+
+        std::vector<scoped_connection> overflow;
+    };
+
+    using scoped_connection_container = basic_scoped_connection_container<8>;
+
+    struct trackable
+    {
+        void add_tracked_connection(connection const& conn)
+        {
+            container.append(conn);
+        }
+
+        void disconnect_tracked_connections() noexcept
+        {
+            container.disconnect();
+        }
+
+    private:
+        scoped_connection_container container;
+    };
+
+    ROCKET_NODISCARD inline connection current_connection() noexcept
+    {
+        auto th = detail::get_thread_local_data();
+        return connection{ th->current_connection, th->is_thread_safe_connection };
+    }
+
+    inline void abort_emission() noexcept
+    {
+        detail::get_thread_local_data()->emission_aborted = true;
+    }
+
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+    struct scoped_connection_blocker final
+    {
+        scoped_connection_blocker(connection c) noexcept
+            : conn{ std::move(c) }
+        {
+            conn.block();
+        }
+
+        ~scoped_connection_blocker() noexcept
+        {
+            conn.unblock();
+        }
+
+    private:
+        scoped_connection_blocker(scoped_connection_blocker const&) = delete;
+        scoped_connection_blocker& operator=(scoped_connection_blocker const&) = delete;
+
+        connection conn;
+    };
+#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
+
+    namespace detail
+    {
+#ifndef ROCKET_NO_TIMERS
+        struct timer_queue final
+        {
+            using slot_type = slot_function<void()>;
+
+            timer_queue()
+            {
+                init();
+            }
+
+            ~timer_queue() noexcept
+            {
+                destroy();
+            }
+
+            timer_queue(timer_queue&& q)
+                : head{ std::move(q.head) }
+                , tail{ std::move(q.tail) }
+                , heap{ std::move(q.heap) }
+            {
+                q.init();
+            }
+
+            timer_queue(timer_queue const& q)
+            {
+                init();
+                copy(q);
+            }
+
+            timer_queue& operator=(timer_queue&& rhs)
+            {
+                destroy();
+                head = std::move(rhs.head);
+                tail = std::move(rhs.tail);
+                heap = std::move(rhs.heap);
+                rhs.init();
+                return *this;
+            }
+
+            timer_queue& operator=(timer_queue const& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    copy(rhs);
+                }
+                return *this;
+            }
+
+            template <class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(slot_type slot, std::chrono::duration<Rep, Period> const& interval)
+            {
+                assert(slot != nullptr);
+
+                auto expires_at = std::chrono::steady_clock::now() + interval;
+                auto interval_microsecs = std::chrono::duration_cast<std::chrono::microseconds>(interval);
+                connection_base* base
+                    = make_link(tail, std::move(slot), std::move(expires_at), std::move(interval_microsecs));
+                return connection{ static_cast<void*>(base), false };
+            }
+
+            template <auto Method, class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(std::chrono::duration<Rep, Period> const& interval)
+            {
+                return set_interval<Rep, Period>([] { (*Method)(); }, interval);
+            }
+
+            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(
+                Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+            {
+                connection c{ set_interval<Rep, Period>([&object, method] { (object.*method)(); }, interval) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable&>(object).add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(Instance& object, std::chrono::duration<Rep, Period> const& interval)
+            {
+                connection c{ set_interval<Rep, Period>([&object] { (object.*Method)(); }, interval) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable&>(object).add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(
+                Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+            {
+                connection c{ set_interval<Rep, Period>([object, method] { (object->*method)(); }, interval) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable*>(object)->add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+            connection set_interval(Instance* object, std::chrono::duration<Rep, Period> const& interval)
+            {
+                connection c{ set_interval<Rep, Period>([object] { (object->*Method)(); }, interval) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable*>(object)->add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(slot_type slot, std::chrono::duration<Rep, Period> const& timeout)
+            {
+                assert(slot != nullptr);
+
+                auto expires_at = std::chrono::steady_clock::now() + timeout;
+                connection_base* base
+                    = make_link(tail, std::move(slot), std::move(expires_at), std::chrono::microseconds(-1));
+                return connection{ static_cast<void*>(base), false };
+            }
+
+            template <auto Method, class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(std::chrono::duration<Rep, Period> const& timeout)
+            {
+                return set_timeout<Rep, Period>([] { (*Method)(); }, timeout);
+            }
+
+            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(
+                Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+            {
+                connection c{ set_timeout<Rep, Period>([&object, method] { (object.*method)(); }, timeout) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable&>(object).add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(Instance& object, std::chrono::duration<Rep, Period> const& timeout)
+            {
+                connection c{ set_timeout<Rep, Period>([&object] { (object.*Method)(); }, timeout) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable&>(object).add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(
+                Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+            {
+                connection c{ set_timeout<Rep, Period>([object, method] { (object->*method)(); }, timeout) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable*>(object)->add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+            connection set_timeout(Instance* object, std::chrono::duration<Rep, Period> const& timeout)
+            {
+                connection c{ set_timeout<Rep, Period>([object] { (object->*Method)(); }, timeout) };
+                if constexpr (std::is_convertible_v<Instance*, trackable*>)
+                {
+                    static_cast<trackable*>(object)->add_tracked_connection(c);
+                }
+                return c;
+            }
+
+            void clear() noexcept
+            {
+                intrusive_ptr<connection_base> current{ head->next };
+                while (current != tail)
+                {
+                    intrusive_ptr<connection_base> next{ current->next };
+                    current->next = tail;
+                    current->prev = nullptr;
+                    current = std::move(next);
+                }
+
+                head->next = tail;
+                tail->prev = head;
+                heap.clear();
+            }
+
+            void swap(timer_queue& other) noexcept
+            {
+                if (this != &other)
+                {
+                    head.swap(other.head);
+                    tail.swap(other.tail);
+                    heap.swap(other.heap);
+                }
+            }
+
+            bool dispatch(std::chrono::time_point<std::chrono::steady_clock> execute_until)
+            {
+#    ifndef ROCKET_NO_EXCEPTIONS
+                bool error{ false };
+#    endif
+                bool not_enough_time{ false };
+                std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
+                {
+                    detail::thread_local_data* th{ detail::get_thread_local_data() };
+                    detail::abort_scope ascope{ th };
+
+                    // Entries handled during this pass (fired intervals and
+                    // currently blocked timers) are parked here and re-inserted
+                    // afterwards, so a zero interval can't make the loop spin.
+                    std::vector<timer_entry> deferred;
+
+                    while (!heap.empty())
+                    {
+                        if (heap.front().expires_at > now)
+                            ROCKET_LIKELY
+                            {
+                                // The earliest deadline is still pending; so is
+                                // everything behind it.
+                                break;
+                            }
+
+                        std::pop_heap(heap.begin(), heap.end(), timer_entry_after{});
+                        timer_entry entry{ std::move(heap.back()) };
+                        heap.pop_back();
+
+                        timed_connection* conn = entry.connection;
+
+                        if (conn->prev == nullptr)
+                            ROCKET_UNLIKELY
+                            {
+                                // Disconnected while queued; drop the entry.
+                                continue;
+                            }
+
+                        if (conn->expires_at > now)
+                        {
+                            // The deadline moved; queue the entry back in at
+                            // its new position.
+                            entry.expires_at = conn->expires_at;
+                            heap.push_back(std::move(entry));
+                            std::push_heap(heap.begin(), heap.end(), timer_entry_after{});
+                            continue;
+                        }
+
+#    ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+                        if (conn->block_count != 0)
+                        {
+                            // Fires as soon as it gets unblocked.
+                            deferred.push_back(std::move(entry));
+                            continue;
+                        }
+#    endif
+
+                        detail::connection_scope cscope{ conn, false, th };
+
+                        if (conn->interval.count() < 0)
+                        {
+                            conn->disconnect();
+                        }
+                        else
+                        {
+                            conn->expires_at = now + conn->interval;
+                        }
+#    ifndef ROCKET_NO_EXCEPTIONS
+                        try
+                        {
+#    endif
+                            conn->slot();
+#    ifndef ROCKET_NO_EXCEPTIONS
+                        }
+                        catch (...)
+                        {
+                            error = true;
+                        }
+#    endif
+#    ifdef ROCKET_ENABLE_STATS
+                        get_queue_stats_data().timer_fired_count.fetch_add(1, std::memory_order_relaxed);
+#    endif
+                        if (conn->prev != nullptr && conn->interval.count() >= 0)
+                        {
+                            // Still connected and periodic; park it for the
+                            // next pass at its new deadline.
+                            entry.expires_at = conn->expires_at;
+                            deferred.push_back(std::move(entry));
+                        }
+
+                        if (execute_until != std::chrono::time_point<std::chrono::steady_clock>{})
+                            ROCKET_UNLIKELY
+                            {
+                                // Check if we already spent the maximum allowed time executing callbacks
+                                if (execute_until <= std::chrono::steady_clock::now())
+                                {
+                                    not_enough_time = true;
+                                    break;
+                                }
+                            }
+
+                        if (th->emission_aborted)
+                            ROCKET_UNLIKELY
+                            {
+                                break;
+                            }
+                    }
+
+                    for (timer_entry& entry : deferred)
+                    {
+                        heap.push_back(std::move(entry));
+                        std::push_heap(heap.begin(), heap.end(), timer_entry_after{});
+                    }
+                }
+
+#    ifndef ROCKET_NO_EXCEPTIONS
+                if (error)
+                    ROCKET_UNLIKELY
+                    {
+                        throw invocation_slot_error{};
+                    }
+#    endif
+                return not_enough_time;
+            }
+
+            // Earliest live deadline in the queue, or time_point::max() when
+            // no timer is pending. Entries of disconnected timers are dropped
+            // and entries whose deadline moved are re-sorted while they sit at
+            // the top, the same lazy cleanup dispatch performs, so the
+            // returned deadline is exact.
+            ROCKET_NODISCARD std::chrono::time_point<std::chrono::steady_clock> next_deadline() noexcept
+            {
+                while (!heap.empty())
+                {
+                    timed_connection* conn = heap.front().connection;
+
+                    if (conn->prev == nullptr)
+                        ROCKET_UNLIKELY
+                        {
+                            // Disconnected while queued; drop the entry.
+                            std::pop_heap(heap.begin(), heap.end(), timer_entry_after{});
+                            heap.pop_back();
+                            continue;
+                        }
+
+                    if (conn->expires_at != heap.front().expires_at)
+                        ROCKET_UNLIKELY
+                        {
+                            // The deadline moved; queue the entry back in at
+                            // its new position.
+                            std::pop_heap(heap.begin(), heap.end(), timer_entry_after{});
+                            heap.back().expires_at = conn->expires_at;
+                            std::push_heap(heap.begin(), heap.end(), timer_entry_after{});
+                            continue;
+                        }
+
+                    return heap.front().expires_at;
+                }
+                return std::chrono::time_point<std::chrono::steady_clock>::max();
+            }
+
+        private:
+            using connection_base = detail::connection_base<thread_unsafe_policy>;
+
+            // Min-heap index over the intrusive timer list, ordered by
+            // deadline. The list keeps its role for connection semantics and
+            // copying; the heap makes insertion O(log n) and dispatch cost
+            // proportional to the timers actually due. Entries of timers that
+            // get disconnected are dropped lazily when they surface at the
+            // top.
+            struct timer_entry final
+            {
+                std::chrono::time_point<std::chrono::steady_clock> expires_at;
+                intrusive_ptr<timed_connection> connection;
+            };
+
+            struct timer_entry_after final
+            {
+                ROCKET_NODISCARD bool operator()(timer_entry const& lhs, timer_entry const& rhs) const noexcept
+                {
+                    return lhs.expires_at > rhs.expires_at;
+                }
+            };
+
+            void init()
+            {
+                head = new connection_base;
+                tail = new connection_base;
+                head->next = tail;
+                tail->prev = head;
+            }
+
+            void destroy() noexcept
+            {
+                clear();
+                head->next = nullptr;
+                tail->prev = nullptr;
+            }
+
+            void copy(timer_queue const& q)
+            {
+                intrusive_ptr<connection_base> current{ q.head->next };
+                intrusive_ptr<connection_base> end{ q.tail };
+
+                while (current != end)
+                {
+                    timed_connection* conn = std::launder(static_cast<timed_connection*>(static_cast<void*>(current)));
+
+                    make_link(tail, conn->slot, conn->expires_at, conn->interval);
+                    current = current->next;
+                }
+            }
+
+            timed_connection* make_link(
+                connection_base* l,
+                slot_type slot,
+                std::chrono::time_point<std::chrono::steady_clock> expires_at,
+                std::chrono::microseconds interval)
+            {
+                intrusive_ptr<timed_connection> link{ new timed_connection };
+                link->slot = std::move(slot);
+                link->expires_at = std::move(expires_at);
+                link->interval = std::move(interval);
+                // Insert into the heap first: if that throws, the node simply
+                // dies, instead of lingering in the list without a deadline.
+                heap.push_back(timer_entry{ link->expires_at, link });
+                std::push_heap(heap.begin(), heap.end(), timer_entry_after{});
+
+                link->prev = l->prev;
+                link->next = l;
+                link->prev->next = link;
+                link->next->prev = link;
+                return link;
+            }
+
+            intrusive_ptr<connection_base> head;
+            intrusive_ptr<connection_base> tail;
+
+            std::vector<timer_entry> heap;
+        };
+
+        inline timer_queue* get_timer_queue() noexcept
+        {
+            static ROCKET_THREAD_LOCAL timer_queue queue;
+            return &queue;
+        }
+
+#endif//~ ROCKET_NO_TIMERS
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        struct call_queue final
+        {
+            static constexpr std::size_t lane_count = 3;
+
+            // Every lane fans out into this many producer slots; producers
+            // land in a stable slot by thread, and dispatch round-robins the
+            // slots, so one chatty producer can't monopolize a time slice
+            // while per-producer FIFO order still holds.
+            static constexpr std::size_t producer_slot_count = 4;
+
+            // Budget checks read the clock at most once per this many tasks.
+            static constexpr std::size_t max_budget_stride = 64;
+
+            ~call_queue() noexcept
+            {
+                for (std::size_t index = 0; index < lane_count; ++index)
+                {
+                    for (call_node* node : pool_lanes[index])
+                    {
+                        delete node;
+                    }
+                }
+            }
+
+            template <class Callable>
+            void put(std::thread::id tid, unsigned int priority, Callable&& task)
+            {
+                assert(priority < lane_count);
+
+                // Materialize the task first; if node allocation throws there
+                // is nothing to leak, and the move into the node can't throw.
+                task_function fn{ std::forward<Callable>(task) };
+                call_node* node{ new call_node };
+                node->task = std::move(fn);
+
+#ifdef ROCKET_ENABLE_TRACING
+                // Before the push: once the node is visible, the consumer may
+                // run it, and the started event must not precede this one.
+                if (trace_sink* sink = get_trace_sink())
+                {
+                    sink->task_enqueued(node, std::chrono::steady_clock::now());
+                }
+#endif
+
+                mpsc_queue& lane = get_thread_queue(tid)->lanes[priority][producer_slot()];
+                lane.push(node);
+                wake();
+
+#ifdef ROCKET_ENABLE_STATS
+                queue_stats_data& stats = get_queue_stats_data();
+                stats.queued_task_count.fetch_add(1, std::memory_order_relaxed);
+                update_maximum(
+                    stats.queued_depth_high_water, lane.pending.load(std::memory_order_relaxed));
+#endif
+            }
+
+            // Queues a task on the shared any-thread pool; whichever thread
+            // dispatches next - or wakes first - takes it.
+            template <class Callable>
+            void put_any(unsigned int priority, Callable&& task)
+            {
+                assert(priority < lane_count);
+
+                task_function fn{ std::forward<Callable>(task) };
+                call_node* node{ new call_node };
+                node->task = std::move(fn);
+
+#ifdef ROCKET_ENABLE_TRACING
+                if (trace_sink* sink = get_trace_sink())
+                {
+                    sink->task_enqueued(node, std::chrono::steady_clock::now());
+                }
+#endif
+
+                {
+                    std::scoped_lock<std::mutex> guard{ pool_mutex };
+                    pool_lanes[priority].push_back(node);
+                }
+                pool_pending.fetch_add(1, std::memory_order_seq_cst);
+                wake();
+
+#ifdef ROCKET_ENABLE_STATS
+                queue_stats_data& stats = get_queue_stats_data();
+                stats.queued_task_count.fetch_add(1, std::memory_order_relaxed);
+                update_maximum(
+                    stats.queued_depth_high_water, pool_pending.load(std::memory_order_relaxed));
+#endif
+            }
+
+            // Blocks until work for the calling thread or the shared pool is
+            // queued, or the deadline passes; returns whether work is
+            // pending. The waiter count keeps put()'s fast path free of the
+            // wait mutex while nobody sleeps.
+            bool wait(std::chrono::time_point<std::chrono::steady_clock> wait_until)
+            {
+                thread_call_queue* queue = get_thread_queue(std::this_thread::get_id());
+                if (has_pending(queue))
+                {
+                    return true;
+                }
+
+                std::unique_lock<std::mutex> guard{ wait_mutex };
+                waiter_count.fetch_add(1, std::memory_order_seq_cst);
+                bool ready
+                    = wait_condvar.wait_until(guard, wait_until, [&] { return has_pending(queue); });
+                waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                return ready;
+            }
+
+            bool dispatch(std::chrono::time_point<std::chrono::steady_clock> execute_until)
+            {
+                thread_call_queue* queue = get_thread_queue(std::this_thread::get_id());
+
+                bool has_budget = execute_until != std::chrono::time_point<std::chrono::steady_clock>{};
+                std::chrono::time_point<std::chrono::steady_clock> last_check{};
+                if (has_budget)
+                    ROCKET_UNLIKELY
+                    {
+                        last_check = std::chrono::steady_clock::now();
+                    }
+                std::size_t executed_since_check{ 0 };
+
+                bool not_enough_time{ false };
+
+                // The high lane always drains completely; the time budget
+                // only throttles the lanes below it. The clock is read once
+                // per stride of tasks, and the stride adapts: it doubles
+                // while a whole stride costs well under the remaining budget
+                // and shrinks back once the deadline gets close, keeping the
+                // overshoot bounded without a syscall per task.
+                auto out_of_budget = [&](std::size_t lane_index) noexcept
+                {
+                    if (lane_index == 0 || !has_budget)
+                    {
+                        return false;
+                    }
+                    if (++executed_since_check < queue->budget_stride)
+                    {
+                        return false;
+                    }
+                    executed_since_check = 0;
+
+                    auto now = std::chrono::steady_clock::now();
+                    if (execute_until <= now)
+                    {
+                        return true;
+                    }
+
+                    if ((now - last_check) * 4 < execute_until - now)
+                    {
+                        if (queue->budget_stride < max_budget_stride)
+                        {
+                            queue->budget_stride *= 2;
+                        }
+                    }
+                    else if (queue->budget_stride > 1)
+                    {
+                        queue->budget_stride /= 2;
+                    }
+                    last_check = now;
+                    return false;
+                };
+
+                for (std::size_t index = 0; index < lane_count && !not_enough_time; ++index)
+                {
+                    mpsc_queue* slots = queue->lanes[index];
+
+                    // Only drain what was pending when we entered, so tasks
+                    // that enqueue further tasks can't keep this dispatch
+                    // alive forever.
+                    std::size_t limits[producer_slot_count];
+                    std::size_t remaining{ 0 };
+                    for (std::size_t slot = 0; slot < producer_slot_count; ++slot)
+                    {
+                        limits[slot] = slots[slot].pending.load(std::memory_order_acquire);
+                        remaining += limits[slot];
+                    }
+
+                    // One task per producer slot per turn, resuming where the
+                    // previous dispatch left off, so no producer starves the
+                    // others within the slice.
+                    std::size_t cursor = queue->cursor[index];
+
+                    while (remaining != 0)
+                    {
+                        cursor = (cursor + 1) % producer_slot_count;
+                        if (limits[cursor] == 0)
+                        {
+                            continue;
+                        }
+
+                        call_node* node = slots[cursor].pop();
+                        if (node == nullptr)
+                            ROCKET_UNLIKELY
+                            {
+                                remaining -= limits[cursor];
+                                limits[cursor] = 0;
+                                continue;
+                            }
+
+                        --limits[cursor];
+                        --remaining;
+                        slots[cursor].pending.fetch_sub(1, std::memory_order_relaxed);
+
+#ifdef ROCKET_ENABLE_TRACING
+                        if (trace_sink* sink = get_trace_sink())
+                        {
+                            sink->task_started(node, std::chrono::steady_clock::now());
+                        }
+#endif
+                        node->task();
+#ifdef ROCKET_ENABLE_TRACING
+                        if (trace_sink* sink = get_trace_sink())
+                        {
+                            sink->task_finished(node, std::chrono::steady_clock::now());
+                        }
+#endif
+                        delete node;
+
+#ifdef ROCKET_ENABLE_STATS
+                        get_queue_stats_data().executed_task_count.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+                        if (out_of_budget(index))
+                            ROCKET_UNLIKELY
+                            {
+                                not_enough_time = true;
+                                break;
+                            }
+                    }
+
+                    queue->cursor[index] = cursor;
+                }
+
+                // Shared any-thread pool: every dispatching thread helps
+                // drain it, bounded by what was queued when its pass began.
+                for (std::size_t index = 0; index < lane_count && !not_enough_time; ++index)
+                {
+                    std::size_t limit;
+                    {
+                        std::scoped_lock<std::mutex> guard{ pool_mutex };
+                        limit = pool_lanes[index].size();
+                    }
+
+                    while (limit != 0)
+                    {
+                        call_node* node;
+                        {
+                            std::scoped_lock<std::mutex> guard{ pool_mutex };
+                            if (pool_lanes[index].empty())
+                                ROCKET_UNLIKELY
+                                {
+                                    break;
+                                }
+                            node = pool_lanes[index].front();
+                            pool_lanes[index].pop_front();
+                        }
+                        --limit;
+                        pool_pending.fetch_sub(1, std::memory_order_relaxed);
+
+#ifdef ROCKET_ENABLE_TRACING
+                        if (trace_sink* sink = get_trace_sink())
+                        {
+                            sink->task_started(node, std::chrono::steady_clock::now());
+                        }
+#endif
+                        node->task();
+#ifdef ROCKET_ENABLE_TRACING
+                        if (trace_sink* sink = get_trace_sink())
+                        {
+                            sink->task_finished(node, std::chrono::steady_clock::now());
+                        }
+#endif
+                        delete node;
+
+#ifdef ROCKET_ENABLE_STATS
+                        get_queue_stats_data().executed_task_count.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+                        if (out_of_budget(index))
+                            ROCKET_UNLIKELY
+                            {
+                                not_enough_time = true;
+                                break;
+                            }
+                    }
+                }
+
+                if (has_pending(queue))
+                {
+                    return true;
+                }
+                return not_enough_time;
+            }
+
+        private:
+            struct call_node final
+            {
+                std::atomic<call_node*> next{ nullptr };
+                task_function task;
+            };
+
+            // Vyukov-style intrusive MPSC queue. Producers enqueue with two
+            // wait-free atomic stores; the owning thread drains without
+            // taking any lock.
+            struct mpsc_queue final
+            {
+                mpsc_queue() noexcept
+                    : head{ &stub }
+                    , tail{ &stub }
+                {
+                }
+
+                ~mpsc_queue() noexcept
+                {
+                    call_node* node = tail;
+                    while (node != nullptr)
+                    {
+                        call_node* next = node->next.load(std::memory_order_relaxed);
+                        if (node != &stub)
+                        {
+                            delete node;
+                        }
+                        node = next;
+                    }
+                }
+
+                void push(call_node* node) noexcept
+                {
+                    pending.fetch_add(1, std::memory_order_release);
+
+                    node->next.store(nullptr, std::memory_order_relaxed);
+                    call_node* prev = head.exchange(node, std::memory_order_acq_rel);
+                    prev->next.store(node, std::memory_order_release);
+                }
+
+                // May only be called from the owning consumer thread.
+                call_node* pop() noexcept
+                {
+                    call_node* tail_node = tail;
+                    call_node* next = tail_node->next.load(std::memory_order_acquire);
+
+                    if (tail_node == &stub)
+                    {
+                        if (next == nullptr)
+                        {
+                            // Empty, or a producer is between its exchange and
+                            // the link store; either way there is nothing we
+                            // can take right now.
+                            return nullptr;
+                        }
+                        tail = next;
+                        tail_node = next;
+                        next = next->next.load(std::memory_order_acquire);
+                    }
+
+                    if (next != nullptr)
+                    {
+                        tail = next;
+                        return tail_node;
+                    }
+
+                    if (tail_node != head.load(std::memory_order_acquire))
+                    {
+                        // A producer already made itself visible through head
+                        // but has not linked its node yet; the store is just a
+                        // few instructions away.
+                        while ((next = tail_node->next.load(std::memory_order_acquire)) == nullptr)
+                        {
+                            std::this_thread::yield();
+                        }
+                        tail = next;
+                        return tail_node;
+                    }
+
+                    // tail_node is the last element; re-insert the stub behind
+                    // it so the queue is never completely unlinked.
+                    push(&stub);
+                    pending.fetch_sub(1, std::memory_order_relaxed);
+
+                    while ((next = tail_node->next.load(std::memory_order_acquire)) == nullptr)
+                    {
+                        std::this_thread::yield();
+                    }
+                    tail = next;
+                    return tail_node;
+                }
+
+                std::atomic<call_node*> head;
+                call_node* tail;
+                call_node stub;
+
+                std::atomic<std::size_t> pending{ 0 };
+            };
+
+            // One lane per priority class for each consumer thread, fanned
+            // out into producer slots, plus the dispatch scheduling state:
+            // per-lane round-robin cursors and the adaptive budget stride,
+            // both kept across dispatches.
+            struct thread_call_queue final
+            {
+                mpsc_queue lanes[lane_count][producer_slot_count];
+                std::size_t cursor[lane_count]{};
+                std::size_t budget_stride{ 1 };
+            };
+
+            // Stable per producing thread, so per-producer FIFO order holds
+            // while different producers land in different slots.
+            ROCKET_NODISCARD static std::size_t producer_slot()
+            {
+                static ROCKET_THREAD_LOCAL std::size_t slot
+                    = std::hash<std::thread::id>{}(std::this_thread::get_id()) % producer_slot_count;
+                return slot;
+            }
+
+            thread_call_queue* get_thread_queue(std::thread::id tid)
+            {
+                struct cache_entry final
+                {
+                    call_queue* owner;
+                    std::thread::id tid;
+                    thread_call_queue* queue;
+                };
+
+                // Registry entries are never erased, so caching the looked-up
+                // queue keeps the common producer path off the registry lock.
+                static ROCKET_THREAD_LOCAL cache_entry cache{};
+                if (cache.queue != nullptr && cache.owner == this && cache.tid == tid)
+                    ROCKET_LIKELY
+                    {
+                        return cache.queue;
+                    }
+
+                thread_call_queue* queue;
+                {
+                    std::shared_lock<std::shared_mutex> guard{ registry_mutex };
+                    auto iterator = registry.find(tid);
+                    queue = iterator != registry.end() ? &iterator->second : nullptr;
+                }
+
+                if (queue == nullptr)
+                {
+                    std::scoped_lock<std::shared_mutex> guard{ registry_mutex };
+                    queue = &registry[tid];
+                }
+
+                cache = cache_entry{ this, tid, queue };
+                return queue;
+            }
+
+            ROCKET_NODISCARD bool has_pending(thread_call_queue* queue) const noexcept
+            {
+                if (pool_pending.load(std::memory_order_seq_cst) != 0)
+                {
+                    return true;
+                }
+                for (std::size_t index = 0; index < lane_count; ++index)
+                {
+                    for (std::size_t slot = 0; slot < producer_slot_count; ++slot)
+                    {
+                        if (queue->lanes[index][slot].pending.load(std::memory_order_acquire) != 0)
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            void wake() noexcept
+            {
+                // The fence orders the preceding push against the waiter
+                // count read, so a waiter that missed the push is seen here
+                // and notified instead of sleeping through it.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (waiter_count.load(std::memory_order_relaxed) != 0)
+                    ROCKET_UNLIKELY
+                    {
+                        {
+                            std::scoped_lock<std::mutex> guard{ wait_mutex };
+                        }
+                        wait_condvar.notify_all();
+                    }
+            }
+
+            std::shared_mutex registry_mutex;
+            std::unordered_map<std::thread::id, thread_call_queue> registry;
+
+            // Shared any-thread pool plus the sleep/wake machinery behind
+            // wait(); the pool sees every dispatching thread, so a plain
+            // mutex guards it.
+            std::mutex pool_mutex;
+            std::deque<call_node*> pool_lanes[lane_count];
+            std::atomic<std::size_t> pool_pending{ 0 };
+
+            std::mutex wait_mutex;
+            std::condition_variable wait_condvar;
+            std::atomic<std::size_t> waiter_count{ 0 };
+        };
+
+        inline call_queue* get_call_queue() noexcept
+        {
+            static call_queue queue;
+            return &queue;
+        }
+
+        template <class T>
+        struct decay
+        {
+            typedef typename std::remove_reference<T>::type U;
+            typedef typename std::conditional<
+                std::is_array<U>::value,
+                typename std::remove_extent<U>::type*,
+                typename std::conditional<
+                    std::is_function<U>::value,
+                    typename std::add_pointer<U>::type,
+                    typename std::conditional<
+                        std::is_const<U>::value || !std::is_reference<T>::value,
+                        typename std::remove_cv<U>::type,
+                        T>::type>::type>::type type;
+        };
+
+        template <class T>
+        struct unwrap_refwrapper
+        {
+            using type = T;
+        };
+
+        template <class T>
+        struct unwrap_refwrapper<std::reference_wrapper<T>>
+        {
+            using type = T&;
+        };
+
+        template <class T>
+        using special_decay_t = typename unwrap_refwrapper<typename decay<T>::type>::type;
+
+        // This make_tuple implementation is different from std::make_tuple.
+        // This one preserves non-const references as actual reference values.
+        // However const references will be stored by value.
+
+        // make_tuple(int const&) => tuple<int>
+        // make_tuple(int&) => tuple<int&>
 
         template <class... Types>
         ROCKET_NODISCARD auto make_tuple(Types&&... args)
         {
-            return std::tuple<special_decay_t<Types>...>(std::forward<Types>(args)...);
+            return std::tuple<special_decay_t<Types>...>(std::forward<Types>(args)...);
+        }
+
+        // One emission's decayed argument pack, shared by every queued slot
+        // receiving that emission: the arguments are copied once per emission
+        // instead of once per queued slot. Derives from node_allocation, so
+        // an installed node_allocator recycles packs from its pool instead of
+        // hitting the global heap.
+        template <class Tuple>
+        struct shared_queued_args final
+            : ref_counted<shared_queued_args<Tuple>, ref_count_atomic>
+            , node_allocation
+        {
+            template <class... Ts>
+            explicit shared_queued_args(Ts&&... values)
+                : args{ std::forward<Ts>(values)... }
+            {
+            }
+
+            Tuple args;
+        };
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+
+#ifndef ROCKET_NO_SHM_TRANSPORT
+        // Per-thread registry of shared memory receivers; dispatch_queued_calls
+        // pumps each one after the timer and call queues.
+        struct shm_pump_base
+        {
+            virtual std::size_t pump() = 0;
+
+        protected:
+            ~shm_pump_base() = default;
+        };
+
+        inline std::vector<shm_pump_base*>& get_shm_pumps() noexcept
+        {
+            static ROCKET_THREAD_LOCAL std::vector<shm_pump_base*> pumps;
+            return pumps;
+        }
+#endif//~ ROCKET_NO_SHM_TRANSPORT
+    } // namespace detail
+
+#if !defined(ROCKET_NO_TIMERS) || !defined(ROCKET_NO_QUEUED_CONNECTIONS) || !defined(ROCKET_NO_SHM_TRANSPORT)
+    template <class Rep, class Period>
+    inline void dispatch_queued_calls(std::chrono::duration<Rep, Period> const& max_time_to_execute)
+    {
+        std::chrono::time_point<std::chrono::steady_clock> execute_until{};
+        if (max_time_to_execute.count() > 0)
+            ROCKET_UNLIKELY
+            {
+                execute_until = std::chrono::steady_clock::now() + max_time_to_execute;
+            }
+#    ifndef ROCKET_NO_TIMERS
+        bool not_enough_time = detail::get_timer_queue()->dispatch(execute_until);
+        if (not_enough_time)
+            ROCKET_UNLIKELY
+            {
+                return;
+            }
+#    endif
+#    ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        detail::get_call_queue()->dispatch(execute_until);
+#    endif
+#    ifndef ROCKET_NO_SHM_TRANSPORT
+        for (detail::shm_pump_base* pump : detail::get_shm_pumps())
+        {
+            pump->pump();
+        }
+#    endif
+    }
+
+    inline void dispatch_queued_calls()
+    {
+        dispatch_queued_calls(std::chrono::microseconds::zero());
+    }
+
+#    ifndef ROCKET_NO_QUEUED_CONNECTIONS
+    // Sleeping counterpart to polling dispatch_queued_calls: blocks until
+    // queued work for the calling thread or the shared any_thread pool
+    // arrives - put() signals the sleep through a condvar - wakes early for
+    // the calling thread's next timer deadline, then dispatches. A pool of
+    // workers parked in this call drains any_thread connections with no
+    // further plumbing. Returns true when work was dispatched, false when
+    // the timeout passed idle.
+    template <class Rep, class Period>
+    inline bool wait_dispatch_queued_calls(std::chrono::duration<Rep, Period> const& timeout)
+    {
+        auto wait_until = std::chrono::steady_clock::now() + timeout;
+#        ifndef ROCKET_NO_TIMERS
+        auto deadline = detail::get_timer_queue()->next_deadline();
+        if (deadline < wait_until)
+        {
+            wait_until = deadline;
+        }
+#        endif
+        bool ready = detail::get_call_queue()->wait(wait_until);
+#        ifndef ROCKET_NO_TIMERS
+        if (!ready)
+        {
+            ready = detail::get_timer_queue()->next_deadline() <= std::chrono::steady_clock::now();
+        }
+#        endif
+        dispatch_queued_calls();
+        return ready;
+    }
+#    endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+#endif
+
+#ifndef ROCKET_NO_TIMERS
+    // Earliest pending timer deadline of the calling thread, or
+    // time_point::max() when none is pending. Event loops use this to sleep
+    // exactly until the next timer (or their own I/O events) instead of
+    // polling dispatch_queued_calls on a fixed tick. Queued cross-thread
+    // calls still need a wake-up of the loop's own making - posting them
+    // does not adjust this deadline.
+    ROCKET_NODISCARD inline std::chrono::time_point<std::chrono::steady_clock> next_queued_deadline() noexcept
+    {
+        return detail::get_timer_queue()->next_deadline();
+    }
+#endif
+
+#ifndef ROCKET_NO_TIMERS
+    template <class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(std::function<void()> slot, std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Rep, Period>(std::move(slot), interval);
+    }
+
+    template <auto Method, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Method, Rep, Period>(interval);
+    }
+
+    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(
+        Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Instance, Class, R, Rep, Period>(
+            object, method, interval);
+    }
+
+    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(Instance& object, std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Method, Instance, Rep, Period>(object, interval);
+    }
+
+    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(
+        Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Instance, Class, R, Rep, Period>(
+            object, method, interval);
+    }
+
+    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_interval(Instance* object, std::chrono::duration<Rep, Period> const& interval)
+    {
+        return detail::get_timer_queue()->template set_interval<Method, Instance, Rep, Period>(object, interval);
+    }
+
+    template <class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(std::function<void()> slot, std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Rep, Period>(std::move(slot), timeout);
+    }
+
+    template <auto Method, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method, Rep, Period>(timeout);
+    }
+
+    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(
+        Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Instance, Class, R, Rep, Period>(
+            object, method, timeout);
+    }
+
+    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(Instance& object, std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method, Instance, Rep, Period>(object, timeout);
+    }
+
+    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(
+        Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Instance, Class, R, Rep, Period>(
+            object, method, timeout);
+    }
+
+    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
+    inline connection set_timeout(Instance* object, std::chrono::duration<Rep, Period> const& timeout)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method, Instance, Rep, Period>(object, timeout);
+    }
+
+    // Overloads for milliseconds
+    inline connection set_interval(std::function<void()> slot, unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<>(
+            std::move(slot), std::chrono::milliseconds(interval_ms));
+    }
+
+    template <auto Method>
+    inline connection set_interval(unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<Method>(std::chrono::milliseconds(interval_ms));
+    }
+
+    template <class Instance, class Class, class R>
+    inline connection set_interval(Instance& object, R (Class::*method)(), unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<Instance, Class, R>(
+            object, method, std::chrono::milliseconds(interval_ms));
+    }
+
+    template <auto Method, class Instance>
+    inline connection set_interval(Instance& object, unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<Method, Instance>(
+            object, std::chrono::milliseconds(interval_ms));
+    }
+
+    template <class Instance, class Class, class R>
+    inline connection set_interval(Instance* object, R (Class::*method)(), unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<Instance, Class, R>(
+            object, method, std::chrono::milliseconds(interval_ms));
+    }
+
+    template <auto Method, class Instance>
+    inline connection set_interval(Instance* object, unsigned long interval_ms)
+    {
+        return detail::get_timer_queue()->template set_interval<Method, Instance>(
+            object, std::chrono::milliseconds(interval_ms));
+    }
+
+    inline connection set_timeout(std::function<void()> slot, unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<>(
+            std::move(slot), std::chrono::milliseconds(timeout_ms));
+    }
+
+    template <auto Method>
+    inline connection set_timeout(unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method>(std::chrono::milliseconds(timeout_ms));
+    }
+
+    template <class Instance, class Class, class R>
+    inline connection set_timeout(Instance& object, R (Class::*method)(), unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<Instance, Class, R>(
+            object, method, std::chrono::milliseconds(timeout_ms));
+    }
+
+    template <auto Method, class Instance>
+    inline connection set_timeout(Instance& object, unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method, Instance>(
+            object, std::chrono::milliseconds(timeout_ms));
+    }
+
+    template <class Instance, class Class, class R>
+    inline connection set_timeout(Instance* object, R (Class::*method)(), unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<Instance, Class, R>(
+            object, method, std::chrono::milliseconds(timeout_ms));
+    }
+
+    template <auto Method, class Instance>
+    inline connection set_timeout(Instance* object, unsigned long timeout_ms)
+    {
+        return detail::get_timer_queue()->template set_timeout<Method, Instance>(
+            object, std::chrono::milliseconds(timeout_ms));
+    }
+
+    inline void clear_timers() noexcept
+    {
+        detail::get_timer_queue()->clear();
+    }
+#endif//~ ROCKET_NO_TIMERS
+
+    template <class T>
+    struct default_collector final : last<optional<T>>
+    {
+    };
+
+    template <>
+    struct default_collector<void>
+    {
+        using value_type = void;
+        using result_type = void;
+
+        void operator()() noexcept
+        {
+            /* do nothing for void types */
+        }
+
+        void result() noexcept
+        {
+            /* do nothing for void types */
+        }
+    };
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+    // The move-only task type handed to executor sinks; see the executor
+    // overload of signal::connect.
+    using queued_task = detail::task_function;
+#endif
+
+    enum connection_flags : unsigned int
+    {
+        direct_connection = 0,
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        queued_connection = 1 << 0,
+#endif
+        connect_as_first_slot = 1 << 1,
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        // Priority lanes for queued slots: dispatch_queued_calls always
+        // drains higher lanes first, and its time budget only throttles the
+        // lanes below high.
+        queued_connection_high = queued_connection | 1 << 2,
+        queued_connection_low = queued_connection | 1 << 3,
+        // Queued, but not pinned to the connecting thread: tasks go to a
+        // shared pool that any thread dispatching (or waiting in
+        // wait_dispatch_queued_calls) takes work from.
+        any_thread_connection = queued_connection | 1 << 4,
+#endif
+    };
+
+    template <
+        class Signature,
+        class Collector = default_collector<detail::get_return_type<Signature>>,
+        class ThreadingPolicy = thread_unsafe_policy>
+    struct signal;
+
+    template <class Collector, class ThreadingPolicy, class R, class... Args>
+    struct signal<R(Args...), Collector, ThreadingPolicy> final
+    {
+        using threading_policy = ThreadingPolicy;
+        using signature_type = R(Args...);
+        using slot_type = std::function<signature_type>;
+
+        signal()
+        {
+            init();
+        }
+
+        ~signal() noexcept
+        {
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+            destroy();
+        }
+
+        signal(signal&& s)
+        {
+            static_assert(
+                std::is_same_v<threading_policy, thread_unsafe_policy>,
+                "Thread safe signals can't be moved or swapped.");
+
+            head = std::move(s.head);
+            tail = std::move(s.tail);
+            snapshot = std::move(s.snapshot);
+#ifndef ROCKET_NO_TARGET_INDEX
+            target_index = std::move(s.target_index);
+            s.target_index.clear();
+#endif
+            s.init();
+        }
+
+        signal(signal const& s)
+        {
+            init();
+
+            std::scoped_lock<shared_lock_state> guard{ s.lock_state };
+            copy(s);
+        }
+
+        signal& operator=(signal&& rhs)
+        {
+            static_assert(
+                std::is_same_v<threading_policy, thread_unsafe_policy>,
+                "Thread safe signals can't be moved or swapped.");
+
+            destroy();
+            head = std::move(rhs.head);
+            tail = std::move(rhs.tail);
+            snapshot = std::move(rhs.snapshot);
+#ifndef ROCKET_NO_TARGET_INDEX
+            target_index = std::move(rhs.target_index);
+            rhs.target_index.clear();
+#endif
+            rhs.init();
+            return *this;
+        }
+
+        signal& operator=(signal const& rhs)
+        {
+            if (this != &rhs)
+            {
+                std::scoped_lock<shared_lock_state, shared_lock_state> guard{ lock_state, rhs.lock_state };
+                clear_without_lock();
+                copy(rhs);
+            }
+            return *this;
+        }
+
+        template <
+            class Callable,
+            std::enable_if_t<std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>, int> = 0>
+        connection connect(Callable&& slot, connection_flags flags = direct_connection)
+        {
+            if constexpr (std::is_constructible_v<bool, std::decay_t<Callable> const&>)
+            {
+                assert(static_cast<bool>(slot));
+            }
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            std::thread::id tid{};
+
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                if ((flags & queued_connection) != 0)
+                    ROCKET_UNLIKELY
+                    {
+                        tid = std::this_thread::get_id();
+                    }
+            }
+            else
+            {
+                assert((flags & queued_connection) == 0);
+            }
+#endif
+
+            bool first = (flags & connect_as_first_slot) != 0;
+
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+            connection_base* base = make_link(
+                first ? head->next : tail,
+                std::forward<Callable>(slot)
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                    ,
+                tid
+#endif
+            );
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                if ((flags & queued_connection_high) == queued_connection_high)
+                {
+                    base->queue_priority = 0;
+                }
+                else if ((flags & queued_connection_low) == queued_connection_low)
+                {
+                    base->queue_priority = 2;
+                }
+                if ((flags & any_thread_connection) == any_thread_connection)
+                {
+                    base->any_thread = true;
+                }
+            }
+#endif
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                publish_snapshot();
+            }
+
+            return connection{ static_cast<void*>(base), threading_policy::is_thread_safe };
+        }
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+        // Queued emissions for this slot are handed straight to the given
+        // executor's post() instead of the global per-thread call queue, so
+        // an event loop with its own task queue avoids the double hop. The
+        // executor must outlive the connection.
+        template <
+            class Executor,
+            class Callable,
+            std::enable_if_t<
+                detail::is_executor<Executor>::value
+                    && std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>,
+                int> = 0>
+        connection connect(Executor& executor, Callable&& slot, connection_flags flags = direct_connection)
+        {
+            static_assert(
+                threading_policy::is_thread_safe, "Executor connections require a thread safe signal.");
+
+            bool first = (flags & connect_as_first_slot) != 0;
+
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+            functional_connection* link
+                = make_link(first ? head->next : tail, std::forward<Callable>(slot), std::thread::id{});
+            link->executor = [exec = std::addressof(executor)](detail::task_function task)
+            {
+                exec->post(std::move(task));
+            };
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                publish_snapshot();
+            }
+
+            return connection{ static_cast<void*>(static_cast<connection_base*>(link)),
+                               threading_policy::is_thread_safe };
+        }
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+
+        // Connects every callable in [first, last) under a single lock
+        // acquisition, linking the nodes in one pass and rebuilding the
+        // emission snapshot once at the end - bulk registration of tens of
+        // thousands of slots pays the per-connect fixed cost once instead of
+        // per slot. The callables keep their range order, also with
+        // connect_as_first_slot. Batch node allocation is the node_allocator
+        // customization point's job: install an arena there and the nodes
+        // come out of contiguous blocks.
+        template <class Iterator>
+        std::vector<connection> connect_many(Iterator first, Iterator last, connection_flags flags = direct_connection)
+        {
+            using callable_type = std::decay_t<decltype(*first)>;
+            static_assert(
+                std::is_invocable_r_v<R, callable_type&, Args...>,
+                "The range elements must be callable with the signal's signature.");
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            std::thread::id tid{};
+
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                if ((flags & queued_connection) != 0)
+                    ROCKET_UNLIKELY
+                    {
+                        tid = std::this_thread::get_id();
+                    }
+            }
+            else
+            {
+                assert((flags & queued_connection) == 0);
+            }
+#endif
+
+            std::vector<connection> connections;
+
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+
+            // Everything goes in before the same node, so the range order
+            // survives for both front and back insertion.
+            connection_base* pos = (flags & connect_as_first_slot) != 0 ? head->next : tail;
+
+            for (; first != last; ++first)
+            {
+                connection_base* base = make_link(
+                    pos,
+                    *first
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                        ,
+                    tid
+#endif
+                );
+
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                if constexpr (threading_policy::is_thread_safe)
+                {
+                    if ((flags & queued_connection_high) == queued_connection_high)
+                    {
+                        base->queue_priority = 0;
+                    }
+                    else if ((flags & queued_connection_low) == queued_connection_low)
+                    {
+                        base->queue_priority = 2;
+                    }
+                    if ((flags & any_thread_connection) == any_thread_connection)
+                    {
+                        base->any_thread = true;
+                    }
+                }
+#endif
+
+                connections.emplace_back(
+                    connection{ static_cast<void*>(base), threading_policy::is_thread_safe });
+            }
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                publish_snapshot();
+            }
+
+            return connections;
+        }
+
+        std::vector<connection> connect_many(
+            std::initializer_list<slot_type> slots, connection_flags flags = direct_connection)
+        {
+            return connect_many(slots.begin(), slots.end(), flags);
+        }
+
+        template <class R1, class... Args1>
+        connection connect(R1 (*method)(Args1...), connection_flags flags = direct_connection)
+        {
+            return connect([method](Args const&... args) { return R((*method)(Args1(args)...)); }, flags);
+        }
+
+        template <auto Method>
+        connection connect(connection_flags flags = direct_connection)
+        {
+            return connect([](Args const&... args) { return R((*Method)(args...)); }, flags);
+        }
+
+        template <class Instance, class Class, class R1, class... Args1>
+        connection connect(Instance& object, R1 (Class::*method)(Args1...), connection_flags flags = direct_connection)
+        {
+            connection c{ connect(
+                [&object, method](Args const&... args) { return R((object.*method)(Args1(args)...)); }, flags) };
+#ifndef ROCKET_NO_TARGET_INDEX
+            register_target(std::addressof(object), c);
+#endif
+            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            {
+                static_cast<trackable&>(object).add_tracked_connection(c);
+            }
+            return c;
+        }
+
+        template <auto Method, class Instance>
+        connection connect(Instance& object, connection_flags flags = direct_connection)
+        {
+            connection c{ connect(detail::bound_method<Method, Instance>{ std::addressof(object) }, flags) };
+#ifndef ROCKET_NO_TARGET_INDEX
+            register_target(std::addressof(object), c);
+#endif
+            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            {
+                static_cast<trackable&>(object).add_tracked_connection(c);
+            }
+            return c;
+        }
+
+        template <class Instance, class Class, class R1, class... Args1>
+        connection connect(Instance* object, R1 (Class::*method)(Args1...), connection_flags flags = direct_connection)
+        {
+            connection c{ connect(
+                [object, method](Args const&... args) { return R((object->*method)(Args1(args)...)); }, flags) };
+#ifndef ROCKET_NO_TARGET_INDEX
+            register_target(object, c);
+#endif
+            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            {
+                static_cast<trackable*>(object)->add_tracked_connection(c);
+            }
+            return c;
+        }
+
+        template <auto Method, class Instance>
+        connection connect(Instance* object, connection_flags flags = direct_connection)
+        {
+            connection c{ connect(detail::bound_method<Method, Instance>{ object }, flags) };
+#ifndef ROCKET_NO_TARGET_INDEX
+            register_target(object, c);
+#endif
+            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            {
+                static_cast<trackable*>(object)->add_tracked_connection(c);
+            }
+            return c;
+        }
+
+        template <
+            class Callable,
+            std::enable_if_t<std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>, int> = 0>
+        connection operator+=(Callable&& slot)
+        {
+            return connect(std::forward<Callable>(slot));
+        }
+
+#ifndef ROCKET_NO_TARGET_INDEX
+        // Disconnects every slot that was connected to the given object
+        // through one of the object-targeted connect overloads. The target
+        // index maps the object's address straight to its connection nodes,
+        // so this doesn't scan the connection list. Returns the number of
+        // slots that were still connected.
+        template <class Instance>
+        std::size_t disconnect(Instance& object)
+        {
+            return disconnect_target(std::addressof(object));
+        }
+
+        template <class Instance>
+        std::size_t disconnect(Instance* object)
+        {
+            return disconnect_target(object);
+        }
+#endif//~ ROCKET_NO_TARGET_INDEX
+
+        void clear() noexcept
+        {
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+            clear_without_lock();
+        }
+
+        void swap(signal& other) noexcept
+        {
+            static_assert(
+                std::is_same_v<threading_policy, thread_unsafe_policy>,
+                "Thread safe signals can't be moved or swapped.");
+
+            if (this != &other)
+            {
+                head.swap(other.head);
+                tail.swap(other.tail);
+                snapshot.swap(other.snapshot);
+#ifndef ROCKET_NO_TARGET_INDEX
+                target_index.swap(other.target_index);
+#endif
+            }
+        }
+
+        ROCKET_NODISCARD std::size_t get_slot_count() const noexcept
+        {
+            std::size_t count{ 0 };
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+            intrusive_ptr<connection_base> current{ head->next };
+            intrusive_ptr<connection_base> end{ tail };
+            while (current != end)
+            {
+                if (is_entry_live(current))
+                {
+                    ++count;
+                }
+                current = current->next;
+            }
+            return count;
+        }
+
+        template <class ValueCollector = Collector>
+        auto invoke(Args const&... args) const
+        {
+            auto batch = std::forward_as_tuple(args...);
+            return invoke_batch<ValueCollector>(&batch, &batch + 1);
+        }
+
+        // Applies every argument tuple in [first, last) as one emission each,
+        // but takes the lock and resolves the emission snapshot only once for
+        // the whole batch, amortizing the fixed per-emission cost that
+        // dominates small payloads. abort_emission() cancels the remainder of
+        // the batch; collected values accumulate across the entire range.
+        template <class ValueCollector = Collector, class Iterator>
+        auto invoke_batch(Iterator first, Iterator last) const
+        {
+            ValueCollector collector{};
+            emit_range(collector, first, last);
+            return collector.result();
+        }
+
+        // Collects every slot's return value through *out++, so results land
+        // in a caller-owned, preallocated buffer with nothing allocated on
+        // the emission path. Returns the advanced iterator.
+        template <class OutputIterator>
+        OutputIterator invoke_into(OutputIterator out, Args const&... args) const
+        {
+            static_assert(!std::is_void_v<R>, "invoke_into requires a value returning signal");
+
+            detail::output_collector<R, OutputIterator> collector{ std::move(out) };
+            auto batch = std::forward_as_tuple(args...);
+            emit_range(collector, &batch, &batch + 1);
+            return collector.result();
         }
-#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
-    } // namespace detail
 
-#if !defined(ROCKET_NO_TIMERS) || !defined(ROCKET_NO_QUEUED_CONNECTIONS)
-    template <class Rep, class Period>
-    inline void dispatch_queued_calls(std::chrono::duration<Rep, Period> const& max_time_to_execute)
-    {
-        std::chrono::time_point<std::chrono::steady_clock> execute_until{};
-        if (max_time_to_execute.count() > 0)
-            ROCKET_UNLIKELY
+#ifdef ROCKET_HAS_COROUTINES
+        // co_await sig suspends the coroutine until the next emission and
+        // resumes it - inside that emission - with the emitted arguments:
+        // void for empty signatures, the value itself for one argument, a
+        // tuple otherwise. The awaiting slot is one-shot.
+        struct await_state final : ref_counted<await_state, ref_count_atomic>
+        {
+            std::mutex mutex;
+            connection conn;
+            optional<std::tuple<std::decay_t<Args>...>> values;
+        };
+
+        struct emission_awaiter final
+        {
+            explicit emission_awaiter(signal& s) noexcept
+                : sig{ s }
             {
-                execute_until = std::chrono::steady_clock::now() + max_time_to_execute;
             }
-#    ifndef ROCKET_NO_TIMERS
-        bool not_enough_time = detail::get_timer_queue()->dispatch(execute_until);
-        if (not_enough_time)
-            ROCKET_UNLIKELY
+
+            ~emission_awaiter() noexcept
             {
-                return;
+                if (state != nullptr)
+                {
+                    // Destroyed without having fired (coroutine torn down):
+                    // take the one-shot slot back out.
+                    std::scoped_lock<std::mutex> guard{ state->mutex };
+                    state->conn.disconnect();
+                }
             }
-#    endif
-#    ifndef ROCKET_NO_QUEUED_CONNECTIONS
-        detail::get_call_queue()->dispatch(execute_until);
-#    endif
-    }
 
-    inline void dispatch_queued_calls()
-    {
-        dispatch_queued_calls(std::chrono::microseconds::zero());
-    }
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                // All mutable data lives in a shared, ref-counted block: a
+                // thread-safe signal can fire - and resume and destroy this
+                // frame - while this thread is still inside await_suspend, so
+                // nothing of the awaiter itself may be touched once the slot
+                // is registered.
+                state = new await_state;
+                intrusive_ptr<await_state> shared{ state };
+
+                connection conn = sig.connect(
+                    [shared, handle](Args const&... args) -> R
+                    {
+                        {
+                            std::scoped_lock<std::mutex> guard{ shared->mutex };
+                            shared->values.emplace(args...);
+                        }
+                        current_connection().disconnect();
+                        handle.resume();
+                        if constexpr (!std::is_void_v<R>)
+                        {
+                            static_assert(
+                                std::is_default_constructible_v<R>,
+                                "Awaiting a value returning signal requires a default constructible return type.");
+                            return R();
+                        }
+                    });
+
+                std::scoped_lock<std::mutex> guard{ shared->mutex };
+                shared->conn = std::move(conn);
+            }
+
+            auto await_resume()
+            {
+                assert(state->values.has_value());
+                if constexpr (sizeof...(Args) == 0)
+                {
+                    return;
+                }
+                else if constexpr (sizeof...(Args) == 1)
+                {
+                    return std::get<0>(std::move(*state->values));
+                }
+                else
+                {
+                    return std::move(*state->values);
+                }
+            }
+
+        private:
+            signal& sig;
+            intrusive_ptr<await_state> state;
+        };
+
+        ROCKET_NODISCARD emission_awaiter operator co_await()
+        {
+            return emission_awaiter{ *this };
+        }
+
+        // Emission variant for coroutines: like invoke, but value-returning
+        // queued slots don't block the emitting thread. The coroutine
+        // suspends and is resumed - with the collected result - by whichever
+        // thread's dispatch_queued_calls completes the last queued slot; with
+        // no queued slots pending it resumes immediately.
+        template <class ValueCollector = Collector>
+        ROCKET_NODISCARD auto invoke_async(Args const&... args) const
+        {
+            return async_emission<ValueCollector>{ this, std::tuple<std::decay_t<Args>...>{ args... } };
+        }
+#endif//~ ROCKET_HAS_COROUTINES
+
+    private:
+#ifdef ROCKET_HAS_COROUTINES
+        template <class ValueCollector>
+        struct async_shared_state final : ref_counted<async_shared_state<ValueCollector>, ref_count_atomic>
+        {
+            ValueCollector collector{};
+            std::mutex collector_mutex;
+            std::atomic<long> pending{ 1 };
+            std::atomic<bool> error{ false };
+            std::coroutine_handle<> handle;
+
+            void complete_one()
+            {
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    handle.resume();
+                }
+            }
+        };
+
+        template <class ValueCollector>
+        struct async_emission final
+        {
+            signal const* sig;
+            std::tuple<std::decay_t<Args>...> args;
+            intrusive_ptr<async_shared_state<ValueCollector>> state;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                state = new async_shared_state<ValueCollector>;
+                state->handle = handle;
+                sig->emit_async(*state, args);
+
+                // The walk itself held one pending reference; if it was the
+                // last one, every slot already completed and there is nothing
+                // to wait for.
+                return state->pending.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            auto await_resume()
+            {
+#ifndef ROCKET_NO_EXCEPTIONS
+                if (state->error.load(std::memory_order_relaxed))
+                    ROCKET_UNLIKELY
+                    {
+                        throw invocation_slot_error{};
+                    }
 #endif
+                return state->collector.result();
+            }
+        };
 
-#ifndef ROCKET_NO_TIMERS
-    template <class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(std::function<void()> slot, std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Rep, Period>(std::move(slot), interval);
-    }
+        template <class ValueCollector>
+        void emit_async(
+            async_shared_state<ValueCollector>& state, std::tuple<std::decay_t<Args>...> const& args) const
+        {
+            detail::thread_local_data* th{ detail::get_thread_local_data() };
+            detail::abort_scope ascope{ th };
 
-    template <auto Method, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Method, Rep, Period>(interval);
-    }
+#ifdef ROCKET_ENABLE_TRACING
+            detail::trace_emission_scope tscope{ static_cast<void const*>(this) };
+#endif
 
-    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(
-        Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Instance, Class, R, Rep, Period>(
-            object, method, interval);
-    }
+            lock_state.lock_emission();
 
-    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(Instance& object, std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Method, Instance, Rep, Period>(object, interval);
-    }
+            intrusive_ptr<connection_snapshot> snap;
+            connection_snapshot const* active_snapshot = nullptr;
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                rcu.active.fetch_add(1, std::memory_order_seq_cst);
+                active_snapshot = rcu.reader.load(std::memory_order_seq_cst);
+            }
+            else if constexpr (threading_policy::is_shared_lock)
+            {
+                snap = snapshot;
+                if (snap == nullptr)
+                    ROCKET_UNLIKELY
+                    {
+                        lock_state.unlock_emission();
+                        {
+                            std::scoped_lock<shared_lock_state> guard{ lock_state };
+                            snap = acquire_snapshot();
+                        }
+                        lock_state.lock_emission();
+                    }
+                active_snapshot = snap;
+            }
+            else
+            {
+                snap = acquire_snapshot();
+                active_snapshot = snap;
+            }
+            bool has_stale_entries{ false };
 
-    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(
-        Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Instance, Class, R, Rep, Period>(
-            object, method, interval);
-    }
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            // Shared by every queued slot of this emission; the arguments are
+            // copied into it once instead of once per queued slot.
+            intrusive_ptr<queued_args> pack;
+#endif
 
-    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_interval(Instance* object, std::chrono::duration<Rep, Period> const& interval)
-    {
-        return detail::get_timer_queue()->template set_interval<Method, Instance, Rep, Period>(object, interval);
-    }
+            for (std::size_t index = 0; active_snapshot != nullptr && index < active_snapshot->connections.size();
+                 ++index)
+            {
+                intrusive_ptr<connection_base> const& current = active_snapshot->connections[index];
 
-    template <class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(std::function<void()> slot, std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Rep, Period>(std::move(slot), timeout);
-    }
+                if (is_entry_live(current)
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+                    && !is_entry_blocked(current)
+#endif
+                )
+                    ROCKET_LIKELY
+                    {
+                        detail::connection_scope cscope{ current, threading_policy::is_thread_safe, th };
 
-    template <auto Method, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method, Rep, Period>(timeout);
-    }
+                        lock_state.unlock_emission();
 
-    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(
-        Instance& object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Instance, Class, R, Rep, Period>(
-            object, method, timeout);
-    }
+                        functional_connection* conn
+                            = std::launder(static_cast<functional_connection*>(static_cast<void*>(current)));
 
-    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(Instance& object, std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method, Instance, Rep, Period>(object, timeout);
-    }
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                        bool queued{ false };
+                        if constexpr (threading_policy::is_thread_safe)
+                        {
+                            queued = current->is_queued();
+                        }
+
+                        if (queued)
+                            ROCKET_UNLIKELY
+                            {
+                                state.pending.fetch_add(1, std::memory_order_relaxed);
+
+                                if (pack == nullptr)
+                                {
+                                    pack = intrusive_ptr<queued_args>{ new queued_args{ args } };
+                                }
+
+                                intrusive_ptr<async_shared_state<ValueCollector>> shared{ &state };
+                                route_queued(
+                                    current,
+                                    [current, shared, pack]
+                                    {
+                                        if (current->is_connected())
+                                            ROCKET_LIKELY
+                                            {
+                                                detail::thread_local_data* th{ detail::get_thread_local_data() };
+                                                detail::connection_scope cscope{
+                                                    current, threading_policy::is_thread_safe, th
+                                                };
+
+                                                functional_connection* conn
+                                                    = std::launder(static_cast<functional_connection*>(
+                                                        static_cast<void*>(current)));
+#ifndef ROCKET_NO_EXCEPTIONS
+                                                try
+                                                {
+#endif
+                                                    if constexpr (std::is_void_v<R>)
+                                                    {
+                                                        std::apply(conn->slot, pack->args);
+                                                        std::scoped_lock<std::mutex> guard{
+                                                            shared->collector_mutex
+                                                        };
+                                                        shared->collector();
+                                                    }
+                                                    else
+                                                    {
+                                                        auto value = std::apply(conn->slot, pack->args);
+                                                        std::scoped_lock<std::mutex> guard{
+                                                            shared->collector_mutex
+                                                        };
+                                                        shared->collector(std::move(value));
+                                                    }
+#ifndef ROCKET_NO_EXCEPTIONS
+                                                }
+                                                catch (...)
+                                                {
+                                                    shared->error.store(true, std::memory_order_relaxed);
+                                                }
+#endif
+                                            }
+                                        shared->complete_one();
+                                    });
+                            }
+                        else
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+                        {
+#ifndef ROCKET_NO_EXCEPTIONS
+                            try
+                            {
+#endif
+                                if constexpr (std::is_void_v<R>)
+                                {
+                                    std::apply(conn->slot, args);
+                                    std::scoped_lock<std::mutex> guard{ state.collector_mutex };
+                                    state.collector();
+                                }
+                                else
+                                {
+                                    auto value = std::apply(conn->slot, args);
+                                    std::scoped_lock<std::mutex> guard{ state.collector_mutex };
+                                    state.collector(std::move(value));
+                                }
+#ifndef ROCKET_NO_EXCEPTIONS
+                            }
+                            catch (...)
+                            {
+                                state.error.store(true, std::memory_order_relaxed);
+                            }
+#endif
+                        }
+
+                        lock_state.lock_emission();
+
+                        if (th->emission_aborted)
+                            ROCKET_UNLIKELY
+                            {
+                                break;
+                            }
+                    }
+                else if (!is_entry_live(current))
+                    ROCKET_UNLIKELY
+                    {
+                        has_stale_entries = true;
+                    }
+            }
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                // Dead entries stay in the published snapshot until the next
+                // mutation rebuilds it; readers never write shared state.
+                rcu.active.fetch_sub(1, std::memory_order_seq_cst);
+            }
+            else if (has_stale_entries)
+                ROCKET_UNLIKELY
+                {
+                    if constexpr (threading_policy::is_shared_lock)
+                    {
+                        lock_state.unlock_emission();
+                        {
+                            std::scoped_lock<shared_lock_state> guard{ lock_state };
+                            snapshot = nullptr;
+                        }
+                        lock_state.lock_emission();
+                    }
+                    else
+                    {
+                        snapshot = nullptr;
+                    }
+                }
+
+            lock_state.unlock_emission();
+        }
+#endif//~ ROCKET_HAS_COROUTINES
+
+        template <class ValueCollector, class Iterator>
+        void emit_range(ValueCollector& collector, Iterator first, Iterator last) const
+        {
+#ifndef ROCKET_NO_EXCEPTIONS
+            bool error{ false };
+#endif
+            if (first != last)
+            {
+                detail::thread_local_data* th{ detail::get_thread_local_data() };
+                detail::abort_scope ascope{ th };
+
+#ifdef ROCKET_ENABLE_TRACING
+                detail::trace_emission_scope tscope{ static_cast<void const*>(this) };
+#endif
+
+                lock_state.lock_emission();
+
+                intrusive_ptr<connection_snapshot> snap;
+                connection_snapshot const* active_snapshot = nullptr;
+                if constexpr (threading_policy::is_lock_free_emission)
+                {
+                    // Lock-free read side: announce ourselves, then read the
+                    // published snapshot. Mutators only reclaim snapshots they
+                    // retired while no emission was announced.
+                    rcu.active.fetch_add(1, std::memory_order_seq_cst);
+                    active_snapshot = rcu.reader.load(std::memory_order_seq_cst);
+                }
+                else if constexpr (threading_policy::is_shared_lock)
+                {
+                    snap = snapshot;
+                    if (snap == nullptr)
+                        ROCKET_UNLIKELY
+                        {
+                            // Rebuilding mutates shared signal state and thus
+                            // needs the exclusive side of the lock.
+                            lock_state.unlock_emission();
+                            {
+                                std::scoped_lock<shared_lock_state> guard{ lock_state };
+                                snap = acquire_snapshot();
+                            }
+                            lock_state.lock_emission();
+                        }
+                    active_snapshot = snap;
+                }
+                else
+                {
+                    snap = acquire_snapshot();
+                    active_snapshot = snap;
+                }
 
-    template <class Instance, class Class, class R, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(
-        Instance* object, R (Class::*method)(), std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Instance, Class, R, Rep, Period>(
-            object, method, timeout);
-    }
+                if constexpr (detail::collector_has_reserve<ValueCollector>::value)
+                {
+                    // One value per connected slot; for multi-tuple batches
+                    // this reserves one pass worth, which is still the right
+                    // growth hint for the common single-emission case.
+                    collector.reserve(active_snapshot != nullptr ? active_snapshot->connections.size() : 0);
+                }
 
-    template <auto Method, class Instance, class Rep = unsigned long, class Period = std::milli>
-    inline connection set_timeout(Instance* object, std::chrono::duration<Rep, Period> const& timeout)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method, Instance, Rep, Period>(object, timeout);
-    }
+                bool has_stale_entries{ false };
 
-    // Overloads for milliseconds
-    inline connection set_interval(std::function<void()> slot, unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<>(
-            std::move(slot), std::chrono::milliseconds(interval_ms));
-    }
+                for (; active_snapshot != nullptr && first != last; ++first)
+                {
+#ifdef ROCKET_ENABLE_STATS
+                    stats_data.emission_count.fetch_add(1, std::memory_order_relaxed);
+#endif
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                    // Built lazily by the first fire-and-forget queued slot of
+                    // this emission and shared by the rest, so the arguments
+                    // are copied once per emission, not once per queued slot.
+                    intrusive_ptr<queued_args> pack;
+#endif
+                    for (std::size_t index = 0; index < active_snapshot->connections.size(); ++index)
+                    {
+                        intrusive_ptr<connection_base> const& current = active_snapshot->connections[index];
 
-    template <auto Method>
-    inline connection set_interval(unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<Method>(std::chrono::milliseconds(interval_ms));
-    }
+                        assert(current != nullptr);
 
-    template <class Instance, class Class, class R>
-    inline connection set_interval(Instance& object, R (Class::*method)(), unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<Instance, Class, R>(
-            object, method, std::chrono::milliseconds(interval_ms));
-    }
+                        if (is_entry_live(current)
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+                            && !is_entry_blocked(current)
+#endif
+                        )
+                            ROCKET_LIKELY
+                            {
+                                detail::connection_scope cscope{ current,
+                                                                 threading_policy::is_thread_safe,
+                                                                 th };
 
-    template <auto Method, class Instance>
-    inline connection set_interval(Instance& object, unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<Method, Instance>(
-            object, std::chrono::milliseconds(interval_ms));
-    }
+                                lock_state.unlock_emission();
 
-    template <class Instance, class Class, class R>
-    inline connection set_interval(Instance* object, R (Class::*method)(), unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<Instance, Class, R>(
-            object, method, std::chrono::milliseconds(interval_ms));
-    }
+                                functional_connection* conn
+                                    = std::launder(static_cast<functional_connection*>(static_cast<void*>(current)));
 
-    template <auto Method, class Instance>
-    inline connection set_interval(Instance* object, unsigned long interval_ms)
-    {
-        return detail::get_timer_queue()->template set_interval<Method, Instance>(
-            object, std::chrono::milliseconds(interval_ms));
-    }
+                                if constexpr (std::is_same_v<threading_policy, thread_unsafe_policy>)
+                                {
+#ifdef ROCKET_ENABLE_STATS
+                                    auto slot_began = std::chrono::steady_clock::now();
+#endif
+#ifndef ROCKET_NO_EXCEPTIONS
+                                    try
+                                    {
+#endif
+                                        if constexpr (std::is_void_v<R>)
+                                        {
+                                            std::apply(conn->slot, *first);
+                                            collector();
+                                        }
+                                        else
+                                        {
+                                            collector(std::apply(conn->slot, *first));
+                                        }
+#ifndef ROCKET_NO_EXCEPTIONS
+                                    }
+                                    catch (...)
+                                    {
+                                        error = true;
+                                    }
+#endif
+#ifdef ROCKET_ENABLE_STATS
+                                    record_slot_time(slot_began);
+#endif
+                                }
+                                else
+                                {
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                                    if (current->is_queued())
+                                        ROCKET_UNLIKELY
+                                        {
+                                            if constexpr (std::is_void_v<R>)
+                                            {
+                                                if (pack == nullptr)
+                                                {
+                                                    pack = std::apply(
+                                                        [](auto const&... a) {
+                                                            return intrusive_ptr<queued_args>{ new queued_args{
+                                                                a... } };
+                                                        },
+                                                        *first);
+                                                }
+
+                                                // Fire-and-forget slots don't need the future state a
+                                                // packaged_task would allocate; a plain task suffices.
+                                                route_queued(
+                                                    current,
+                                                    [current, pack]
+                                                    {
+                                                        if (current->is_connected())
+                                                            ROCKET_LIKELY
+                                                            {
+                                                                detail::thread_local_data* th{
+                                                                    detail::get_thread_local_data()
+                                                                };
+                                                                detail::connection_scope cscope{
+                                                                    current,
+                                                                    threading_policy::is_thread_safe,
+                                                                    th
+                                                                };
+
+                                                                functional_connection* conn
+                                                                    = std::launder(static_cast<functional_connection*>(
+                                                                        static_cast<void*>(current)));
+
+                                                                std::apply(conn->slot, pack->args);
+                                                            }
+                                                    });
+                                            }
+                                            else
+                                            {
+                                                // If we are calling a queued slot, and our signal requires a return value
+                                                // we actually have to block the thread until the slot was dispatched
+                                                std::packaged_task<void()> task(
+                                                    [current, &collector, args = std::apply([](auto const&... a) { return std::forward_as_tuple(a...); }, *first)]
+                                                    {
+                                                        if (current->is_connected())
+                                                            ROCKET_LIKELY
+                                                            {
+                                                                detail::thread_local_data* th{
+                                                                    detail::get_thread_local_data()
+                                                                };
+                                                                detail::connection_scope cscope{
+                                                                    current,
+                                                                    threading_policy::is_thread_safe,
+                                                                    th
+                                                                };
+
+                                                                functional_connection* conn
+                                                                    = std::launder(static_cast<functional_connection*>(
+                                                                        static_cast<void*>(current)));
+
+                                                                collector(std::apply(conn->slot, args));
+                                                            }
+                                                    });
+
+                                                std::future<void> future{ task.get_future() };
+                                                route_queued(current, std::move(task));
+#    ifndef ROCKET_NO_EXCEPTIONS
+                                                try
+                                                {
+#    endif
+                                                    future.get();
+#    ifndef ROCKET_NO_EXCEPTIONS
+                                                }
+                                                catch (...)
+                                                {
+                                                    error = true;
+                                                }
+#    endif
+                                            }
+                                        }
+                                    else
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
+                                    {
+#ifdef ROCKET_ENABLE_STATS
+                                        auto slot_began = std::chrono::steady_clock::now();
+#endif
+#ifndef ROCKET_NO_EXCEPTIONS
+                                        try
+                                        {
+#endif
+                                            if constexpr (std::is_void_v<R>)
+                                            {
+                                                std::apply(conn->slot, *first);
+                                                collector();
+                                            }
+                                            else
+                                            {
+                                                collector(std::apply(conn->slot, *first));
+                                            }
+#ifndef ROCKET_NO_EXCEPTIONS
+                                        }
+                                        catch (...)
+                                        {
+                                            error = true;
+                                        }
+#endif
+#ifdef ROCKET_ENABLE_STATS
+                                        record_slot_time(slot_began);
+#endif
+                                    }
+                                }
 
-    inline connection set_timeout(std::function<void()> slot, unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<>(
-            std::move(slot), std::chrono::milliseconds(timeout_ms));
-    }
+                                lock_state.lock_emission();
 
-    template <auto Method>
-    inline connection set_timeout(unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method>(std::chrono::milliseconds(timeout_ms));
-    }
+                                if (th->emission_aborted)
+                                    ROCKET_UNLIKELY
+                                    {
+                                        break;
+                                    }
 
-    template <class Instance, class Class, class R>
-    inline connection set_timeout(Instance& object, R (Class::*method)(), unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<Instance, Class, R>(
-            object, method, std::chrono::milliseconds(timeout_ms));
-    }
+                                if constexpr (detail::collector_has_done<ValueCollector>::value)
+                                {
+                                    // The collector is satisfied; the remaining
+                                    // slots don't run, like an emission abort
+                                    // with a collected result.
+                                    if (collector.done())
+                                        ROCKET_UNLIKELY
+                                        {
+                                            break;
+                                        }
+                                }
+                            }
+                        else if (!is_entry_live(current))
+                            ROCKET_UNLIKELY
+                            {
+                                has_stale_entries = true;
+                            }
+                    }
 
-    template <auto Method, class Instance>
-    inline connection set_timeout(Instance& object, unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method, Instance>(
-            object, std::chrono::milliseconds(timeout_ms));
-    }
+                    if (th->emission_aborted)
+                        ROCKET_UNLIKELY
+                        {
+                            break;
+                        }
 
-    template <class Instance, class Class, class R>
-    inline connection set_timeout(Instance* object, R (Class::*method)(), unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<Instance, Class, R>(
-            object, method, std::chrono::milliseconds(timeout_ms));
-    }
+                    if constexpr (detail::collector_has_done<ValueCollector>::value)
+                    {
+                        if (collector.done())
+                            ROCKET_UNLIKELY
+                            {
+                                break;
+                            }
+                    }
+                }
 
-    template <auto Method, class Instance>
-    inline connection set_timeout(Instance* object, unsigned long timeout_ms)
-    {
-        return detail::get_timer_queue()->template set_timeout<Method, Instance>(
-            object, std::chrono::milliseconds(timeout_ms));
-    }
+#ifdef ROCKET_ENABLE_STATS
+                if (th->emission_aborted)
+                    ROCKET_UNLIKELY
+                    {
+                        stats_data.abort_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+#endif
 
-    inline void clear_timers() noexcept
-    {
-        detail::get_timer_queue()->clear();
-    }
-#endif//~ ROCKET_NO_TIMERS
+                if constexpr (threading_policy::is_lock_free_emission)
+                {
+                    // Dead entries stay in the published snapshot until the next
+                    // mutation rebuilds it; readers never write shared state.
+                    rcu.active.fetch_sub(1, std::memory_order_seq_cst);
+                }
+                else if (has_stale_entries)
+                    ROCKET_UNLIKELY
+                    {
+                        if constexpr (threading_policy::is_shared_lock)
+                        {
+                            lock_state.unlock_emission();
+                            {
+                                std::scoped_lock<shared_lock_state> guard{ lock_state };
+                                snapshot = nullptr;
+                            }
+                            lock_state.lock_emission();
+                        }
+                        else
+                        {
+                            snapshot = nullptr;
+                        }
+                    }
 
-    template <class T>
-    struct default_collector final : last<optional<T>>
-    {
-    };
+                lock_state.unlock_emission();
+            }
 
-    template <>
-    struct default_collector<void>
-    {
-        using value_type = void;
-        using result_type = void;
+#ifndef ROCKET_NO_EXCEPTIONS
+            if (error)
+                ROCKET_UNLIKELY
+                {
+                    throw invocation_slot_error{};
+                }
+#endif
+        }
 
-        void operator()() noexcept
+    public:
+        auto operator()(Args const&... args) const
         {
-            /* do nothing for void types */
+            return invoke(args...);
         }
 
-        void result() noexcept
+#ifdef ROCKET_ENABLE_STATS
+        ROCKET_NODISCARD signal_stats stats() const noexcept
         {
-            /* do nothing for void types */
+            return signal_stats{
+                stats_data.emission_count.load(std::memory_order_relaxed),
+                stats_data.slot_call_count.load(std::memory_order_relaxed),
+                stats_data.slot_time_total_ns.load(std::memory_order_relaxed),
+                stats_data.slot_time_max_ns.load(std::memory_order_relaxed),
+                stats_data.abort_count.load(std::memory_order_relaxed),
+            };
         }
-    };
+#endif//~ ROCKET_ENABLE_STATS
+
+    private:
+        using shared_lock_state = detail::shared_lock_state<threading_policy>;
+        using connection_base = detail::connection_base<detail::node_policy<threading_policy>>;
+        using functional_connection
+            = detail::functional_connection<detail::node_policy<threading_policy>, signature_type>;
+        using connection_snapshot = detail::connection_snapshot<detail::node_policy<threading_policy>>;
 
-    enum connection_flags : unsigned int
-    {
-        direct_connection = 0,
 #ifndef ROCKET_NO_QUEUED_CONNECTIONS
-        queued_connection = 1 << 0,
+        using queued_args = detail::shared_queued_args<std::tuple<std::decay_t<Args>...>>;
 #endif
-        connect_as_first_slot = 1 << 1,
-    };
 
-    template <
-        class Signature,
-        class Collector = default_collector<detail::get_return_type<Signature>>,
-        class ThreadingPolicy = thread_unsafe_policy>
-    struct signal;
+        // Requires the signal lock to be held. Rebuilds the flat emission
+        // snapshot from the intrusive list after a connect, or after a
+        // previous emission came across disconnected entries.
+        intrusive_ptr<connection_snapshot> acquire_snapshot() const
+        {
+            if (snapshot == nullptr)
+                ROCKET_UNLIKELY
+                {
+                    intrusive_ptr<connection_snapshot> rebuilt{ new connection_snapshot };
 
-    template <class Collector, class ThreadingPolicy, class R, class... Args>
-    struct signal<R(Args...), Collector, ThreadingPolicy> final
-    {
-        using threading_policy = ThreadingPolicy;
-        using signature_type = R(Args...);
-        using slot_type = std::function<signature_type>;
+                    intrusive_ptr<connection_base> current{ head->next };
+                    intrusive_ptr<connection_base> end{ tail };
+
+                    while (current != end)
+                    {
+                        if (is_entry_live(current))
+                        {
+                            rebuilt->connections.emplace_back(current);
+                        }
+                        current = current->next;
+                    }
+
+                    snapshot = std::move(rebuilt);
+                }
+            return snapshot;
+        }
 
-        signal()
+        // Liveness check for a snapshot entry. Thread safe emission reads the
+        // atomic mirror instead of the list links: the links belong to the
+        // mutators, and a lock-free disconnect flips the flag before it gets
+        // around to the unlink.
+        ROCKET_NODISCARD static bool is_entry_live(connection_base* current) noexcept
         {
-            init();
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                return current->connected_state.load(std::memory_order_acquire);
+            }
+            else
+            {
+                return current->prev != nullptr;
+            }
         }
 
-        ~signal() noexcept
+#ifndef ROCKET_NO_BLOCKING_CONNECTIONS
+        ROCKET_NODISCARD static bool is_entry_blocked(connection_base* current) noexcept
         {
-            std::scoped_lock<shared_lock_state> guard{ lock_state };
-            destroy();
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                return current->block_count.load(std::memory_order_acquire) != 0;
+            }
+            else
+            {
+                return current->block_count != 0;
+            }
         }
+#endif//~ ROCKET_NO_BLOCKING_CONNECTIONS
 
-        signal(signal&& s)
+        // Rebuilds the published read snapshot from the intrusive list;
+        // callers must hold the exclusive lock. Only used by
+        // thread_safe_rcu_policy, where mutations pay for the rebuild so
+        // emission never has to.
+        void publish_snapshot()
         {
-            static_assert(
-                std::is_same_v<threading_policy, thread_unsafe_policy>,
-                "Thread safe signals can't be moved or swapped.");
+            intrusive_ptr<connection_snapshot> rebuilt{ new connection_snapshot };
 
-            head = std::move(s.head);
-            tail = std::move(s.tail);
-            s.init();
-        }
+            intrusive_ptr<connection_base> current{ head->next };
+            intrusive_ptr<connection_base> end{ tail };
 
-        signal(signal const& s)
-        {
-            init();
+            while (current != end)
+            {
+                if (is_entry_live(current))
+                {
+                    rebuilt->connections.emplace_back(current);
+                }
+                current = current->next;
+            }
 
-            std::scoped_lock<shared_lock_state> guard{ s.lock_state };
-            copy(s);
+            rcu.publish(std::move(rebuilt));
         }
 
-        signal& operator=(signal&& rhs)
+#ifndef ROCKET_NO_TARGET_INDEX
+        // Records an object-targeted connection in the target index so
+        // disconnect(object) can find its node without scanning the list.
+        // Dead entries in the bucket are pruned while we are here, so the
+        // buckets of long-lived targets don't accumulate stale nodes.
+        void register_target(void const* target, connection const& c)
         {
-            static_assert(
-                std::is_same_v<threading_policy, thread_unsafe_policy>,
-                "Thread safe signals can't be moved or swapped.");
+            connection_base* base{ std::launder(static_cast<connection_base*>(c.base)) };
 
-            destroy();
-            head = std::move(rhs.head);
-            tail = std::move(rhs.tail);
-            rhs.init();
-            return *this;
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+
+            static_cast<functional_connection*>(base)->target = target;
+
+            std::vector<intrusive_ptr<connection_base>>& nodes = target_index[target];
+            nodes.erase(
+                std::remove_if(
+                    nodes.begin(),
+                    nodes.end(),
+                    [](intrusive_ptr<connection_base> const& node) { return node->prev == nullptr; }),
+                nodes.end());
+            nodes.emplace_back(base);
         }
 
-        signal& operator=(signal const& rhs)
+        std::size_t disconnect_target(void const* target)
         {
-            if (this != &rhs)
+            std::size_t count{ 0 };
+
+            std::scoped_lock<shared_lock_state> guard{ lock_state };
+
+            auto it = target_index.find(target);
+            if (it != target_index.end())
             {
-                std::scoped_lock<shared_lock_state, shared_lock_state> guard{ lock_state, rhs.lock_state };
-                clear_without_lock();
-                copy(rhs);
+                for (intrusive_ptr<connection_base> const& node : it->second)
+                {
+                    if (node->prev != nullptr)
+                    {
+                        ++count;
+                        if constexpr (threading_policy::is_thread_safe)
+                        {
+                            node->disconnect_without_lock();
+                        }
+                        else
+                        {
+                            node->disconnect();
+                        }
+                    }
+                }
+                target_index.erase(it);
+
+                if constexpr (threading_policy::is_lock_free_emission)
+                {
+                    publish_snapshot();
+                }
             }
-            return *this;
+            return count;
         }
-
-        connection connect(slot_type slot, connection_flags flags = direct_connection)
-        {
-            assert(slot != nullptr);
-
+#endif//~ ROCKET_NO_TARGET_INDEX
 
 #ifndef ROCKET_NO_QUEUED_CONNECTIONS
-            std::thread::id tid{};
-
-            if constexpr (std::is_same_v<threading_policy, thread_safe_policy>)
+        // Hands a queued task to the connection's executor if one was given
+        // at connect time, and to the global call queue otherwise.
+        template <class Task>
+        static void route_queued(connection_base* conn, Task&& task)
+        {
+            if constexpr (threading_policy::is_thread_safe)
             {
-                if ((flags & queued_connection) != 0)
+                if (conn->executor != nullptr)
                     ROCKET_UNLIKELY
                     {
-                        tid = std::this_thread::get_id();
+                        conn->executor(detail::task_function{ std::forward<Task>(task) });
+                        return;
                     }
             }
-            else
+            unsigned int priority = 1;
+            if constexpr (threading_policy::is_thread_safe)
             {
-                assert((flags & queued_connection) == 0);
+                priority = conn->queue_priority;
+                if (conn->any_thread)
+                    ROCKET_UNLIKELY
+                    {
+                        detail::get_call_queue()->put_any(priority, std::forward<Task>(task));
+                        return;
+                    }
             }
-#endif
-
-            bool first = (flags & connect_as_first_slot) != 0;
-
-            std::scoped_lock<shared_lock_state> guard{ lock_state };
-            connection_base* base = make_link(
-                first ? head->next : tail,
-                std::move(slot)
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-                    ,
-                tid
-#endif
-            );
-
-            return connection{ static_cast<void*>(base), std::is_same_v<threading_policy, thread_safe_policy> };
+            detail::get_call_queue()->put(conn->get_tid(), priority, std::forward<Task>(task));
         }
+#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
 
-        template <class R1, class... Args1>
-        connection connect(R1 (*method)(Args1...), connection_flags flags = direct_connection)
+        void init()
         {
-            return connect([method](Args const&... args) { return R((*method)(Args1(args)...)); }, flags);
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                // The list anchors live inside the signal's control block,
+                // next to the mutex, so an emission's fixed-cost state sits
+                // on one allocation's cache lines.
+                detail::signal_control_block* block
+                    = static_cast<detail::signal_control_block*>(lock_state.lock_primitive.get());
+                head = intrusive_ptr<connection_base>{ block->head() };
+                tail = intrusive_ptr<connection_base>{ block->tail() };
+            }
+            else
+            {
+                head = new connection_base;
+                tail = new connection_base;
+            }
+            head->next = tail;
+            tail->prev = head;
         }
 
-        template <auto Method>
-        connection connect(connection_flags flags = direct_connection)
+        void destroy() noexcept
         {
-            return connect([](Args const&... args) { return R((*Method)(args...)); }, flags);
+            clear_without_lock();
+            head->next = nullptr;
+            tail->prev = nullptr;
         }
 
-        template <class Instance, class Class, class R1, class... Args1>
-        connection connect(Instance& object, R1 (Class::*method)(Args1...), connection_flags flags = direct_connection)
+        void clear_without_lock() noexcept
         {
-            connection c{ connect(
-                [&object, method](Args const&... args) { return R((object.*method)(Args1(args)...)); }, flags) };
-            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            snapshot = nullptr;
+
+            if constexpr (threading_policy::is_thread_safe)
             {
-                static_cast<trackable&>(object).add_tracked_connection(c);
+                detail::bump_generation(lock_state.lock_primitive);
+            }
+
+#ifndef ROCKET_NO_TARGET_INDEX
+            target_index.clear();
+#endif
+
+            intrusive_ptr<connection_base> current{ head->next };
+            while (current != tail)
+            {
+                intrusive_ptr<connection_base> next{ current->next };
+                current->next = tail;
+                current->prev = nullptr;
+                if constexpr (threading_policy::is_thread_safe)
+                {
+                    current->connected_state.store(false, std::memory_order_release);
+                }
+                current = std::move(next);
+            }
+
+            head->next = tail;
+            tail->prev = head;
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                rcu.publish(nullptr);
             }
-            return c;
         }
 
-        template <auto Method, class Instance>
-        connection connect(Instance& object, connection_flags flags = direct_connection)
+        void copy(signal const& s)
         {
-            connection c{ connect([&object](Args const&... args) { return R((object.*Method)(args...)); }, flags) };
-            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            intrusive_ptr<connection_base> current{ s.head->next };
+            intrusive_ptr<connection_base> end{ s.tail };
+
+            while (current != end)
             {
-                static_cast<trackable&>(object).add_tracked_connection(c);
+                functional_connection* conn
+                    = std::launder(static_cast<functional_connection*>(static_cast<void*>(current)));
+
+                ROCKET_MAYBE_UNUSED functional_connection* link = make_link(
+                    tail,
+                    conn->slot
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                    ,
+                    conn->get_tid()
+#endif
+                );
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                if constexpr (threading_policy::is_thread_safe)
+                {
+                    link->queue_priority = conn->queue_priority;
+                    link->any_thread = conn->any_thread;
+                    link->executor = conn->executor;
+                }
+#endif
+#ifndef ROCKET_NO_TARGET_INDEX
+                if (conn->target != nullptr)
+                {
+                    link->target = conn->target;
+                    target_index[conn->target].emplace_back(
+                        intrusive_ptr<connection_base>{ static_cast<connection_base*>(link) });
+                }
+#endif
+                current = current->next;
+            }
+
+            if constexpr (threading_policy::is_lock_free_emission)
+            {
+                publish_snapshot();
             }
-            return c;
         }
 
-        template <class Instance, class Class, class R1, class... Args1>
-        connection connect(Instance* object, R1 (Class::*method)(Args1...), connection_flags flags = direct_connection)
+        template <class Callable>
+        functional_connection* make_link(
+            connection_base* l,
+            Callable&& slot
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            ,
+            ROCKET_MAYBE_UNUSED std::thread::id tid
+#endif
+        )
         {
-            connection c{ connect(
-                [object, method](Args const&... args) { return R((object->*method)(Args1(args)...)); }, flags) };
-            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            intrusive_ptr<functional_connection> link{ new functional_connection };
+
+            if constexpr (threading_policy::is_thread_safe)
             {
-                static_cast<trackable*>(object)->add_tracked_connection(c);
+                link->lock = lock_state.lock_primitive;
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+                link->thread_id = std::move(tid);
+#endif
             }
-            return c;
+
+            link->slot = std::forward<Callable>(slot);
+            link->prev = l->prev;
+            link->next = l;
+            link->prev->next = link;
+            link->next->prev = link;
+            snapshot = nullptr;
+            if constexpr (threading_policy::is_thread_safe)
+            {
+                detail::bump_generation(lock_state.lock_primitive);
+            }
+            return link;
         }
 
-        template <auto Method, class Instance>
-        connection connect(Instance* object, connection_flags flags = direct_connection)
+#ifdef ROCKET_ENABLE_STATS
+        void record_slot_time(std::chrono::time_point<std::chrono::steady_clock> began) const noexcept
         {
-            connection c{ connect([object](Args const&... args) { return R((object->*Method)(args...)); }, flags) };
-            if constexpr (std::is_convertible_v<Instance*, trackable*>)
+            auto elapsed = static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - began)
+                    .count());
+            stats_data.slot_call_count.fetch_add(1, std::memory_order_relaxed);
+            stats_data.slot_time_total_ns.fetch_add(elapsed, std::memory_order_relaxed);
+            detail::update_maximum(stats_data.slot_time_max_ns, elapsed);
+        }
+#endif//~ ROCKET_ENABLE_STATS
+
+        intrusive_ptr<connection_base> head;
+        intrusive_ptr<connection_base> tail;
+
+        mutable intrusive_ptr<connection_snapshot> snapshot;
+
+#ifndef ROCKET_NO_TARGET_INDEX
+        // Maps the object address passed to an object-targeted connect
+        // overload to the connection nodes registered for it; guarded by
+        // lock_state like the connection list itself.
+        std::unordered_map<void const*, std::vector<intrusive_ptr<connection_base>>> target_index;
+#endif
+
+        ROCKET_NO_UNIQUE_ADDRESS mutable detail::
+            rcu_emission_state<connection_snapshot, threading_policy::is_lock_free_emission>
+                rcu;
+
+#ifdef ROCKET_ENABLE_STATS
+        mutable detail::signal_stats_data stats_data;
+#endif
+
+        ROCKET_NO_UNIQUE_ADDRESS mutable shared_lock_state lock_state;
+    };
+
+    template <class Signature, class Collector = default_collector<detail::get_return_type<Signature>>>
+    using thread_safe_signal = signal<Signature, Collector, thread_safe_policy>;
+
+    template <class Signature, class Collector = default_collector<detail::get_return_type<Signature>>>
+    using thread_safe_shared_signal = signal<Signature, Collector, thread_safe_shared_policy>;
+
+    template <class Signature, class Collector = default_collector<detail::get_return_type<Signature>>>
+    using thread_safe_rcu_signal = signal<Signature, Collector, thread_safe_rcu_policy>;
+
+    // Fixed-capacity signal for allocation-free environments: all connection
+    // nodes live in an inline pool inside the signal object and emission
+    // walks the intrusive list directly, so connect, invoke and disconnect
+    // never touch the heap (keep the callables within
+    // ROCKET_SLOT_STORAGE_SIZE - larger ones fall back to an allocation in
+    // the slot wrapper). connect asserts and returns a disconnected handle
+    // once all N slots are taken. The usual connection/scoped_connection
+    // front-end applies, with one hard rule the destructor asserts: since
+    // the node storage sits inside the signal, every connection must be
+    // disconnected and every handle dropped before the signal dies. Thread
+    // unsafe by design - the deterministic-latency configurations this is
+    // for are single threaded.
+    template <std::size_t N, class Signature, class Collector = default_collector<detail::get_return_type<Signature>>>
+    struct static_signal;
+
+    template <std::size_t N, class Collector, class R, class... Args>
+    struct static_signal<N, R(Args...), Collector> final
+    {
+        static_assert(N != 0, "A static_signal needs at least one slot.");
+
+        using signature_type = R(Args...);
+        using slot_type = std::function<signature_type>;
+
+        static_signal()
+        {
+            head = intrusive_ptr<connection_base>{ new (pool.allocate()) node };
+            tail = intrusive_ptr<connection_base>{ new (pool.allocate()) node };
+            head->next = tail;
+            tail->prev = head;
+        }
+
+        ~static_signal() noexcept
+        {
+            clear();
+            head->next = nullptr;
+            tail->prev = nullptr;
+        }
+
+        // The pool is part of the object, so nodes can't change owner.
+        static_signal(static_signal const&) = delete;
+        static_signal& operator=(static_signal const&) = delete;
+
+        template <
+            class Callable,
+            std::enable_if_t<std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>, int> = 0>
+        connection connect(Callable&& slot, connection_flags flags = direct_connection)
+        {
+            if constexpr (std::is_constructible_v<bool, std::decay_t<Callable> const&>)
             {
-                static_cast<trackable*>(object)->add_tracked_connection(c);
+                assert(static_cast<bool>(slot));
             }
-            return c;
-        }
+#ifndef ROCKET_NO_QUEUED_CONNECTIONS
+            assert((flags & queued_connection) == 0);
+#endif
+
+            void* storage = pool.allocate();
+            assert(storage != nullptr && "static_signal capacity exhausted");
+            if (storage == nullptr)
+                ROCKET_UNLIKELY
+                {
+                    return connection{};
+                }
 
-        connection operator+=(slot_type slot)
-        {
-            return connect(std::move(slot));
+            intrusive_ptr<functional_connection> link{ new (storage) node };
+            link->slot = std::forward<Callable>(slot);
+
+            connection_base* l = (flags & connect_as_first_slot) != 0 ? head->next : tail;
+            link->prev = l->prev;
+            link->next = l;
+            link->prev->next = link;
+            link->next->prev = link;
+
+            functional_connection* base = link;
+            return connection{ static_cast<void*>(static_cast<connection_base*>(base)), false };
         }
 
-        void clear() noexcept
+        template <
+            class Callable,
+            std::enable_if_t<std::is_invocable_r_v<R, std::decay_t<Callable>&, Args...>, int> = 0>
+        connection operator+=(Callable&& slot)
         {
-            std::scoped_lock<shared_lock_state> guard{ lock_state };
-            clear_without_lock();
+            return connect(std::forward<Callable>(slot));
         }
 
-        void swap(signal& other) noexcept
+        void clear() noexcept
         {
-            static_assert(
-                std::is_same_v<threading_policy, thread_unsafe_policy>,
-                "Thread safe signals can't be moved or swapped.");
-
-            if (this != &other)
+            intrusive_ptr<connection_base> current{ head->next };
+            while (current != tail)
             {
-                head.swap(other.head);
-                tail.swap(other.tail);
+                intrusive_ptr<connection_base> next{ current->next };
+                current->next = tail;
+                current->prev = nullptr;
+                current = std::move(next);
             }
+
+            head->next = tail;
+            tail->prev = head;
         }
 
         ROCKET_NODISCARD std::size_t get_slot_count() const noexcept
         {
             std::size_t count{ 0 };
-            std::scoped_lock<shared_lock_state> guard{ lock_state };
             intrusive_ptr<connection_base> current{ head->next };
             intrusive_ptr<connection_base> end{ tail };
             while (current != end)
@@ -3014,15 +6567,11 @@ namespace rocket
                 detail::thread_local_data* th{ detail::get_thread_local_data() };
                 detail::abort_scope ascope{ th };
 
-                lock_state.lock();
-
                 intrusive_ptr<connection_base> current{ head->next };
                 intrusive_ptr<connection_base> end{ tail };
 
                 while (current != end)
                 {
-                    assert(current != nullptr);
-
                     if (current->prev != nullptr
 #ifndef ROCKET_NO_BLOCKING_CONNECTIONS
                         && current->block_count == 0
@@ -3030,155 +6579,48 @@ namespace rocket
                     )
                         ROCKET_LIKELY
                         {
-                            detail::connection_scope cscope{ current,
-                                                             std::is_same_v<threading_policy, thread_safe_policy>,
-                                                             th };
+                            detail::connection_scope cscope{ current, false, th };
 
-                            lock_state.unlock();
-
-                            functional_connection* conn
-                                = std::launder(static_cast<functional_connection*>(static_cast<void*>(current)));
-
-                            if constexpr (std::is_same_v<threading_policy, thread_unsafe_policy>)
-                            {
+                            functional_connection* conn = std::launder(
+                                static_cast<functional_connection*>(static_cast<void*>(current)));
 #ifndef ROCKET_NO_EXCEPTIONS
-                                try
-                                {
+                            try
+                            {
 #endif
-                                    if constexpr (std::is_void_v<R>)
-                                    {
-                                        conn->slot(args...);
-                                        collector();
-                                    }
-                                    else
-                                    {
-                                        collector(conn->slot(args...));
-                                    }
-#ifndef ROCKET_NO_EXCEPTIONS
-                                }
-                                catch (...)
+                                if constexpr (std::is_void_v<R>)
                                 {
-                                    error = true;
+                                    conn->slot(args...);
+                                    collector();
                                 }
-#endif
-                            }
-                            else
-                            {
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-                                if (current->is_queued())
-                                    ROCKET_UNLIKELY
-                                    {
-                                        if constexpr (std::is_void_v<R>)
-                                        {
-                                            std::packaged_task<void()> task(
-                                                [current, args = detail::make_tuple(args...)]
-                                                {
-                                                    if (current->is_connected())
-                                                        ROCKET_LIKELY
-                                                        {
-                                                            detail::thread_local_data* th{
-                                                                detail::get_thread_local_data()
-                                                            };
-                                                            detail::connection_scope cscope{
-                                                                current,
-                                                                std::is_same_v<threading_policy, thread_safe_policy>,
-                                                                th
-                                                            };
-
-                                                            functional_connection* conn
-                                                                = std::launder(static_cast<functional_connection*>(
-                                                                    static_cast<void*>(current)));
-
-                                                            std::apply(conn->slot, args);
-                                                        }
-                                                });
-
-                                            detail::get_call_queue()->put(current->get_tid(), std::move(task));
-                                        }
-                                        else
-                                        {
-                                            // If we are calling a queued slot, and our signal requires a return value
-                                            // we actually have to block the thread until the slot was dispatched
-                                            std::packaged_task<void()> task(
-                                                [current, &collector, args = std::forward_as_tuple(args...)]
-                                                {
-                                                    if (current->is_connected())
-                                                        ROCKET_LIKELY
-                                                        {
-                                                            detail::thread_local_data* th{
-                                                                detail::get_thread_local_data()
-                                                            };
-                                                            detail::connection_scope cscope{
-                                                                current,
-                                                                std::is_same_v<threading_policy, thread_safe_policy>,
-                                                                th
-                                                            };
-
-                                                            functional_connection* conn
-                                                                = std::launder(static_cast<functional_connection*>(
-                                                                    static_cast<void*>(current)));
-
-                                                            collector(std::apply(conn->slot, args));
-                                                        }
-                                                });
-
-                                            std::future<void> future{ task.get_future() };
-                                            detail::get_call_queue()->put(current->get_tid(), std::move(task));
-#    ifndef ROCKET_NO_EXCEPTIONS
-                                            try
-                                            {
-#    endif
-                                                future.get();
-#    ifndef ROCKET_NO_EXCEPTIONS
-                                            }
-                                            catch (...)
-                                            {
-                                                error = true;
-                                            }
-#    endif
-                                        }
-                                    }
                                 else
-#endif//~ ROCKET_NO_QUEUED_CONNECTIONS
                                 {
-#ifndef ROCKET_NO_EXCEPTIONS
-                                    try
-                                    {
-#endif
-                                        if constexpr (std::is_void_v<R>)
-                                        {
-                                            conn->slot(args...);
-                                            collector();
-                                        }
-                                        else
-                                        {
-                                            collector(conn->slot(args...));
-                                        }
-#ifndef ROCKET_NO_EXCEPTIONS
-                                    }
-                                    catch (...)
-                                    {
-                                        error = true;
-                                    }
-#endif
+                                    collector(conn->slot(args...));
                                 }
+#ifndef ROCKET_NO_EXCEPTIONS
                             }
-
-                            lock_state.lock();
-
+                            catch (...)
+                            {
+                                error = true;
+                            }
+#endif
                             if (th->emission_aborted)
                                 ROCKET_UNLIKELY
                                 {
                                     break;
                                 }
-                        }
 
+                            if constexpr (detail::collector_has_done<ValueCollector>::value)
+                            {
+                                if (collector.done())
+                                    ROCKET_UNLIKELY
+                                    {
+                                        break;
+                                    }
+                            }
+                        }
                     current = current->next;
                 }
-
-                lock_state.unlock();
             }
-
 #ifndef ROCKET_NO_EXCEPTIONS
             if (error)
                 ROCKET_UNLIKELY
@@ -3195,98 +6637,95 @@ namespace rocket
         }
 
     private:
-        using shared_lock_state = detail::shared_lock_state<threading_policy>;
-        using connection_base = detail::connection_base<threading_policy>;
-        using functional_connection = detail::functional_connection<threading_policy, signature_type>;
+        using connection_base = detail::connection_base<thread_unsafe_policy>;
+        using functional_connection = detail::functional_connection<thread_unsafe_policy, signature_type>;
 
-        void init()
-        {
-            head = new connection_base;
-            tail = new connection_base;
-            head->next = tail;
-            tail->prev = head;
-        }
+        struct node_pool;
 
-        void destroy() noexcept
+        struct node final : functional_connection
         {
-            clear_without_lock();
-            head->next = nullptr;
-            tail->prev = nullptr;
-        }
+            // The inherited class-scope operator new would hide the global
+            // placement form the pool relies on; redeclare it.
+            static void* operator new(std::size_t, void* ptr) noexcept
+            {
+                return ptr;
+            }
 
-        void clear_without_lock() noexcept
-        {
-            intrusive_ptr<connection_base> current{ head->next };
-            while (current != tail)
+            static void operator delete(void*, void*) noexcept
             {
-                intrusive_ptr<connection_base> next{ current->next };
-                current->next = tail;
-                current->prev = nullptr;
-                current = std::move(next);
             }
 
-            head->next = tail;
-            tail->prev = head;
-        }
+            // The deleting destructor looks the deallocation function up in
+            // the most derived class, so a node whose last reference drops
+            // hands its slot back to the pool instead of touching the heap.
+            static void operator delete(void* ptr) noexcept
+            {
+                slot_storage* slot = reinterpret_cast<slot_storage*>(
+                    reinterpret_cast<unsigned char*>(ptr) - offsetof(slot_storage, storage));
+                slot->owner->recycle(slot);
+            }
+        };
 
-        void copy(signal const& s)
+        struct slot_storage final
         {
-            intrusive_ptr<connection_base> current{ s.head->next };
-            intrusive_ptr<connection_base> end{ s.tail };
+            node_pool* owner;
+            slot_storage* next_free;
+            alignas(node) unsigned char storage[sizeof(node)];
+        };
 
-            while (current != end)
+        // The N payload slots plus the two sentinels, chained into a free
+        // list in address order. The destructor runs after the sentinels
+        // released their slots, so a live node at that point means a
+        // connection outlived its signal.
+        struct node_pool final
+        {
+            node_pool() noexcept
             {
-                functional_connection* conn
-                    = std::launder(static_cast<functional_connection*>(static_cast<void*>(current)));
+                for (std::size_t index = N + 2; index != 0; --index)
+                {
+                    slots[index - 1].owner = this;
+                    slots[index - 1].next_free = free_head;
+                    free_head = &slots[index - 1];
+                }
+            }
 
-                make_link(
-                    tail,
-                    conn->slot
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-                    ,
-                    conn->get_tid()
-#endif
-                );
-                current = current->next;
+            ~node_pool() noexcept
+            {
+                assert(live_count == 0 && "a connection outlived its static_signal");
             }
-        }
 
-        functional_connection* make_link(
-            connection_base* l,
-            slot_type slot
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-            ,
-            ROCKET_MAYBE_UNUSED std::thread::id tid
-#endif
-        )
-        {
-            intrusive_ptr<functional_connection> link{ new functional_connection };
+            ROCKET_NODISCARD void* allocate() noexcept
+            {
+                if (free_head == nullptr)
+                    ROCKET_UNLIKELY
+                    {
+                        return nullptr;
+                    }
+                slot_storage* slot = free_head;
+                free_head = slot->next_free;
+                ++live_count;
+                return static_cast<void*>(slot->storage);
+            }
 
-            if constexpr (std::is_same_v<threading_policy, thread_safe_policy>)
+            void recycle(slot_storage* slot) noexcept
             {
-                link->lock = lock_state.lock_primitive;
-#ifndef ROCKET_NO_QUEUED_CONNECTIONS
-                link->thread_id = std::move(tid);
-#endif
+                slot->next_free = free_head;
+                free_head = slot;
+                --live_count;
             }
 
-            link->slot = std::move(slot);
-            link->prev = l->prev;
-            link->next = l;
-            link->prev->next = link;
-            link->next->prev = link;
-            return link;
-        }
+            slot_storage slots[N + 2];
+            slot_storage* free_head{ nullptr };
+            std::size_t live_count{ 0 };
+        };
+
+        // Declared first so it outlives the sentinel handles below.
+        node_pool pool;
 
         intrusive_ptr<connection_base> head;
         intrusive_ptr<connection_base> tail;
-
-        ROCKET_NO_UNIQUE_ADDRESS mutable shared_lock_state lock_state;
     };
 
-    template <class Signature, class Collector = default_collector<detail::get_return_type<Signature>>>
-    using thread_safe_signal = signal<Signature, Collector, thread_safe_policy>;
-
     template <class Instance, class Class, class R, class... Args>
     ROCKET_NODISCARD inline std::function<R(Args...)> slot(Instance& object, R (Class::*method)(Args...))
     {
@@ -3324,6 +6763,182 @@ namespace rocket
     {
         s1.swap(s2);
     }
+
+#ifndef ROCKET_NO_SHM_TRANSPORT
+    // Cross-process transport for emissions with one trivially copyable
+    // argument. The ring lives entirely inside a caller-provided memory
+    // region - the caller maps it with its platform's shared memory API;
+    // rocket itself stays OS-agnostic - and uses indices instead of
+    // pointers plus lock-free address-free atomics, so any process mapping
+    // the region at any address can take part. One producer process writes,
+    // one consumer process reads; payloads are memcpy'd straight into and
+    // out of the mapped slots, with nothing allocated on either path.
+    template <class T>
+    struct shm_ring final
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "The ring payload must be trivially copyable.");
+        static_assert(
+            std::atomic<std::uint64_t>::is_always_lock_free,
+            "The ring indices must be lock-free atomics to work across processes.");
+
+        using value_type = T;
+
+        // Bytes a ring with the given capacity needs; capacity must be a
+        // power of two.
+        ROCKET_NODISCARD static constexpr std::size_t required_size(std::size_t capacity) noexcept
+        {
+            return data_offset() + capacity * sizeof(T);
+        }
+
+        // Initializes a ring inside the given region; call this once, from
+        // the owning process, before any peer attaches.
+        ROCKET_NODISCARD static shm_ring* create(void* memory, std::size_t size, std::size_t capacity) noexcept
+        {
+            assert(memory != nullptr);
+            assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+            assert(size >= required_size(capacity));
+            (void)size;
+
+            shm_ring* ring = new (memory) shm_ring;
+            ring->mask = capacity - 1;
+            return ring;
+        }
+
+        // Attaches to a ring another process created in the mapped region.
+        ROCKET_NODISCARD static shm_ring* open(void* memory) noexcept
+        {
+            assert(memory != nullptr);
+            return std::launder(static_cast<shm_ring*>(memory));
+        }
+
+        ROCKET_NODISCARD bool try_write(T const& value) noexcept
+        {
+            std::uint64_t write = write_index.load(std::memory_order_relaxed);
+            if (write - read_index.load(std::memory_order_acquire) > mask)
+            {
+                drop_count.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            std::memcpy(slot(write), &value, sizeof(T));
+            write_index.store(write + 1, std::memory_order_release);
+            return true;
+        }
+
+        ROCKET_NODISCARD bool try_read(T& value) noexcept
+        {
+            std::uint64_t read = read_index.load(std::memory_order_relaxed);
+            if (read == write_index.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            std::memcpy(&value, slot(read), sizeof(T));
+            read_index.store(read + 1, std::memory_order_release);
+            return true;
+        }
+
+        ROCKET_NODISCARD std::size_t size() const noexcept
+        {
+            return static_cast<std::size_t>(
+                write_index.load(std::memory_order_acquire) - read_index.load(std::memory_order_acquire));
+        }
+
+        ROCKET_NODISCARD bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // Emissions dropped because the ring was full.
+        ROCKET_NODISCARD std::uint64_t dropped() const noexcept
+        {
+            return drop_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        shm_ring() noexcept = default;
+
+        ROCKET_NODISCARD static constexpr std::size_t data_offset() noexcept
+        {
+            return (sizeof(shm_ring) + alignof(T) - 1) / alignof(T) * alignof(T);
+        }
+
+        ROCKET_NODISCARD void* slot(std::uint64_t index) noexcept
+        {
+            return reinterpret_cast<unsigned char*>(this) + data_offset()
+                + static_cast<std::size_t>(index & mask) * sizeof(T);
+        }
+
+        // Producer and consumer indices on their own cache lines, so the two
+        // processes don't false-share.
+        alignas(64) std::atomic<std::uint64_t> write_index{ 0 };
+        alignas(64) std::atomic<std::uint64_t> read_index{ 0 };
+        alignas(64) std::atomic<std::uint64_t> drop_count{ 0 };
+        std::uint64_t mask{ 0 };
+    };
+
+    // Producer side: a slot that forwards every emission into the ring.
+    // Connect it to the local signal and the peer process's receiver sees
+    // the payloads. A full ring drops the emission, fire-and-forget like a
+    // queued void slot; drops are counted on the ring itself.
+    template <class T>
+    struct shm_emitter final
+    {
+        explicit shm_emitter(shm_ring<T>& r) noexcept
+            : ring{ &r }
+        {
+        }
+
+        void operator()(T const& value) noexcept
+        {
+            (void)ring->try_write(value);
+        }
+
+    private:
+        shm_ring<T>* ring;
+    };
+
+    // Consumer side: drains the ring into the local on_message signal
+    // whenever the owning thread runs dispatch_queued_calls, so shared
+    // memory payloads arrive through the same dispatch loop as queued and
+    // timed slots. One pass drains at most what was pending when it began,
+    // keeping a flooding producer from wedging the loop. Must be created,
+    // dispatched and destroyed on the same thread.
+    template <class T>
+    struct shm_receiver final : detail::shm_pump_base
+    {
+        explicit shm_receiver(shm_ring<T>& r)
+            : ring{ &r }
+        {
+            detail::get_shm_pumps().push_back(this);
+        }
+
+        ~shm_receiver() noexcept
+        {
+            std::vector<detail::shm_pump_base*>& pumps = detail::get_shm_pumps();
+            pumps.erase(std::find(pumps.begin(), pumps.end(), this));
+        }
+
+        shm_receiver(shm_receiver const&) = delete;
+        shm_receiver& operator=(shm_receiver const&) = delete;
+
+        std::size_t pump() override
+        {
+            std::size_t limit = ring->size();
+            std::size_t consumed{ 0 };
+            T value;
+            while (consumed < limit && ring->try_read(value))
+            {
+                on_message.invoke(value);
+                ++consumed;
+            }
+            return consumed;
+        }
+
+        signal<void(T const&)> on_message;
+
+    private:
+        shm_ring<T>* ring;
+    };
+#endif//~ ROCKET_NO_SHM_TRANSPORT
 }// namespace rocket
 
 #endif